@@ -0,0 +1,60 @@
+#include <utility>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// контейнер из n элементов перекладывается туда-обратно moves раз:
+// время на одно перемещение не должно зависеть от n
+template <typename C, typename Fill>
+static void bench_moves(const char* label, size_type n, size_type moves,
+                        Fill fill) {
+  C a;
+  fill(a, n);
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < moves; i++) {
+      C b(std::move(a));
+      s21_bench::do_not_optimize(b);
+      a = std::move(b);
+    }
+  });
+  s21_bench::do_not_optimize(a);
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s move ctor+assign", label);
+  s21_bench::report(name, n, ns, moves);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  const size_type moves = 100000;
+  for (size_type n = 1000; n <= max_n; n *= 1000) {
+    bench_moves<s21::vector<int>>("s21::vector", n, moves,
+                                  [](auto& c, size_type count) {
+                                    for (size_type i = 0; i < count; i++)
+                                      c.push_back(static_cast<int>(i));
+                                  });
+    bench_moves<s21::list<int>>("s21::list", n, moves,
+                                [](auto& c, size_type count) {
+                                  for (size_type i = 0; i < count; i++)
+                                    c.push_back(static_cast<int>(i));
+                                });
+    bench_moves<s21::map<int, int>>("s21::map", n, moves,
+                                    [](auto& c, size_type count) {
+                                      for (size_type i = 0; i < count; i++)
+                                        c.insert(static_cast<int>(i), 0);
+                                    });
+    bench_moves<s21::set<int>>("s21::set", n, moves,
+                               [](auto& c, size_type count) {
+                                 for (size_type i = 0; i < count; i++)
+                                   c.insert(static_cast<int>(i));
+                               });
+    bench_moves<s21::multiset<int>>("s21::multiset", n, moves,
+                                    [](auto& c, size_type count) {
+                                      for (size_type i = 0; i < count; i++)
+                                        c.insert(static_cast<int>(i % 100));
+                                    });
+  }
+  return 0;
+}
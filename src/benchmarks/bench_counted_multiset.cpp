@@ -0,0 +1,73 @@
+#include <cstdlib>
+#include <new>
+#include <set>
+
+#include "../containersplus/s21_counted_multiset.h"
+#include "../containersplus/s21_multiset.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// счетчик выделений: сколько раз и сколько байт запросили узлы
+static size_type allocations = 0;
+static size_type allocated_bytes = 0;
+
+void* operator new(std::size_t size) {
+  allocations++;
+  allocated_bytes += size;
+  if (void* ptr = std::malloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+// n вставок из distinct различных ключей: чем их меньше, тем больше копий
+template <typename Multiset>
+static void bench_dups(const char* label, size_type n, size_type distinct) {
+  std::vector<int> keys(n);
+  for (int& key : keys) {
+    key = static_cast<int>(s21_bench::rng()() % distinct);
+  }
+  char name[96];
+
+  size_type calls = allocations, bytes = allocated_bytes;
+  Multiset m;
+  double ns = s21_bench::measure_ns([&] {
+    for (int key : keys) m.insert(key);
+  });
+  calls = allocations - calls;
+  bytes = allocated_bytes - bytes;
+  std::snprintf(name, sizeof(name), "%s insert d=%zu (%zu allocs, %zu KB)",
+                label, distinct, calls, bytes / 1024);
+  s21_bench::report(name, n, ns, n);
+
+  // у s21::multiset и std::multiset count проходит все копии ключа
+  const size_type queries = 1000;
+  size_type found = 0;
+  ns = s21_bench::measure_best_ns(3, [&] {
+    for (size_type i = 0; i < queries; i++)
+      found += m.count(static_cast<int>(i * 7919 % distinct));
+  });
+  std::snprintf(name, sizeof(name), "%s count d=%zu", label, distinct);
+  s21_bench::report(name, n, ns, queries);
+
+  long long sum = 0;
+  ns = s21_bench::measure_best_ns(3, [&] {
+    for (auto it = m.begin(); it != m.end(); ++it) sum += *it;
+  });
+  s21_bench::do_not_optimize(found + sum);
+  std::snprintf(name, sizeof(name), "%s iterate d=%zu", label, distinct);
+  s21_bench::report(name, n, ns, n);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n = 100000; n <= max_n; n *= 10) {
+    for (size_type distinct : {size_type{16}, size_type{1000}, n / 10}) {
+      bench_dups<s21::counted_multiset<int>>("counted_multiset", n, distinct);
+      bench_dups<s21::multiset<int>>("s21::multiset", n, distinct);
+      bench_dups<std::multiset<int>>("std::multiset", n, distinct);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,149 @@
+#include <map>
+#include <set>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+static std::vector<int> random_keys(size_type n) {
+  std::vector<int> keys(n);
+  for (int& key : keys) key = static_cast<int>(s21_bench::rng()());
+  return keys;
+}
+
+static void print(const char* label, const char* how, size_type n, double ns) {
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s %s", label, how);
+  s21_bench::report(name, n, ns, n);
+}
+
+// n элементов в пустой контейнер, затем еще n в середину уже заполненного
+static void bench_vector(size_type n, const std::vector<int>& keys) {
+  double bulk = s21_bench::measure_best_ns(3, [&] {
+    s21::vector<int> v;
+    v.insert_many(v.end(), keys.begin(), keys.end());
+    v.insert_many(v.begin() + n / 2, keys.begin(), keys.end());
+    s21_bench::do_not_optimize(v.data());
+  });
+  double single = s21_bench::measure_best_ns(3, [&] {
+    std::vector<int> v;
+    v.insert(v.end(), keys.begin(), keys.end());
+    v.insert(v.begin() + n / 2, keys.begin(), keys.end());
+    s21_bench::do_not_optimize(v.data());
+  });
+  print("s21::vector", "insert_many(range)", 2 * n, bulk);
+  print("std::vector", "insert(range)", 2 * n, single);
+}
+
+// то же для списка: insert_many(first, last) против n одиночных вставок
+static void bench_list(size_type n, const std::vector<int>& keys) {
+  double bulk = s21_bench::measure_best_ns(3, [&] {
+    s21::list<int> l;
+    l.insert_many(l.cbegin(), keys.begin(), keys.end());
+    l.insert_many(l.cbegin(), keys.begin(), keys.end());
+    s21_bench::do_not_optimize(l.front());
+  });
+  double single = s21_bench::measure_best_ns(3, [&] {
+    s21::list<int> l;
+    for (int key : keys) l.insert(l.begin(), key);
+    for (int key : keys) l.insert(l.begin(), key);
+    s21_bench::do_not_optimize(l.front());
+  });
+  print("s21::list", "insert_many(range)", 2 * n, bulk);
+  print("s21::list", "insert x n", 2 * n, single);
+}
+
+template <typename It>
+static void insert_range(s21::set<int>& s, It first, It last) {
+  s.insert_many(first, last);
+}
+template <typename It>
+static void insert_range(std::set<int>& s, It first, It last) {
+  for (; first != last; ++first) s.insert(*first);
+}
+template <typename It>
+static void insert_range(s21::map<int, int>& m, It first, It last) {
+  std::vector<std::pair<int, int>> items;
+  items.reserve(last - first);
+  for (; first != last; ++first) items.emplace_back(*first, 0);
+  m.insert_many(items.begin(), items.end());
+}
+template <typename It>
+static void insert_range(std::map<int, int>& m, It first, It last) {
+  for (; first != last; ++first) m.insert({*first, 0});
+}
+
+// эталон для s21: те же ключи по одному через insert
+struct S21SetLoop : s21::set<int> {};
+template <typename It>
+static void insert_range(S21SetLoop& s, It first, It last) {
+  for (; first != last; ++first) s.insert(*first);
+}
+
+// половина ключей вставляется заранее, вторая половина с повторами - пачкой
+template <typename Map, typename Insert>
+static double fill_tree(const std::vector<int>& keys, Insert insert) {
+  double best = 0;
+  for (int run = 0; run < 3; run++) {
+    Map m;
+    size_type half = keys.size() / 2;
+    for (size_type i = 0; i < half; i++) insert(m, keys[i]);
+    double ns = s21_bench::measure_ns([&] {
+      insert_range(m, keys.begin() + half / 2, keys.end());
+      s21_bench::do_not_optimize(m.size());
+    });
+    if (run == 0 || ns < best) best = ns;
+  }
+  return best;
+}
+
+static void bench_trees(size_type n, const std::vector<int>& keys) {
+  size_type inserted = n - n / 4;
+  auto set_insert = [](auto& s, int key) { s.insert(key); };
+  auto map_insert = [](auto& m, int key) { m.insert({key, 0}); };
+  print("s21::set", "insert_many(range)", inserted,
+        fill_tree<s21::set<int>>(keys, set_insert));
+  print("s21::set", "insert x n", inserted,
+        fill_tree<S21SetLoop>(keys, set_insert));
+  print("std::set", "insert x n", inserted,
+        fill_tree<std::set<int>>(keys, set_insert));
+  print("s21::map", "insert_many(range)", inserted,
+        fill_tree<s21::map<int, int>>(keys, map_insert));
+  print("std::map", "insert x n", inserted,
+        fill_tree<std::map<int, int>>(keys, map_insert));
+}
+
+// пачка из 8 аргументов времени компиляции, повторенная n / 8 раз
+static void bench_variadic(size_type n) {
+  double bulk = s21_bench::measure_best_ns(3, [&] {
+    s21::set<int> s;
+    for (int i = 0; i < static_cast<int>(n); i += 8) {
+      s.insert_many(i + 7, i + 3, i + 5, i + 1, i + 6, i + 2, i + 4, i);
+    }
+    s21_bench::do_not_optimize(s.size());
+  });
+  double single = s21_bench::measure_best_ns(3, [&] {
+    s21::set<int> s;
+    for (int i = 0; i < static_cast<int>(n); i += 8) {
+      for (int d : {7, 3, 5, 1, 6, 2, 4, 0}) s.insert(i + d);
+    }
+    s21_bench::do_not_optimize(s.size());
+  });
+  print("s21::set", "insert_many(8 args)", n, bulk);
+  print("s21::set", "insert x 8", n, single);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n : {1000, 65536, 1000000}) {
+    if (n > max_n) break;
+    std::vector<int> keys = random_keys(n);
+    bench_vector(n, keys);
+    bench_list(n, keys);
+    bench_trees(n, keys);
+    bench_variadic(n);
+  }
+  return 0;
+}
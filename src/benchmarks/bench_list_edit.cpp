@@ -0,0 +1,54 @@
+#include <list>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// курсор двигается на step узлов вперед, с конца списка - снова в начало
+template <typename List, typename It>
+static void advance_wrapped(List& l, It& it, size_type step) {
+  for (size_type i = 0; i < step; i++) {
+    if (it == l.end()) it = l.begin();
+    ++it;
+  }
+  if (it == l.end()) it = l.begin();
+}
+
+// ops случайных правок списка из n узлов: курсор смещается на 0..15 узлов,
+// затем в этом месте вставляется или удаляется элемент
+template <typename List>
+static void bench_random_edits(const char* label, size_type n, size_type ops,
+                               const std::vector<unsigned>& script) {
+  List l;
+  for (size_type i = 0; i < n; i++) l.push_back(static_cast<int>(i));
+  auto it = l.begin();
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < ops; i++) {
+      unsigned r = script[i];
+      advance_wrapped(l, it, r & 15);
+      if (r & 16) {
+        it = l.insert(it, static_cast<int>(i));
+      } else {
+        it = l.erase(it);
+      }
+    }
+  });
+  s21_bench::do_not_optimize(l.size());
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s random edits", label);
+  s21_bench::report(name, n, ns, ops);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  const size_type ops = 1000000;
+  std::vector<unsigned> script(ops);
+  for (unsigned& r : script) r = static_cast<unsigned>(s21_bench::rng()());
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    bench_random_edits<s21::list<int>>("s21::list<int>", n, ops, script);
+    bench_random_edits<std::list<int>>("std::list<int>", n, ops, script);
+  }
+  return 0;
+}
@@ -0,0 +1,76 @@
+#include <cstdlib>
+#include <list>
+#include <new>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// счетчик выделений памяти: merge и splice не должны выделять ничего
+static size_type allocations = 0;
+
+void* operator new(std::size_t size) {
+  allocations++;
+  if (void* ptr = std::malloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+// два отсортированных списка по n элементов: четные и нечетные числа
+template <typename List>
+static void fill(List& evens, List& odds, size_type n) {
+  for (size_type i = 0; i < n; i++) {
+    evens.push_back(static_cast<int>(2 * i));
+    odds.push_back(static_cast<int>(2 * i + 1));
+  }
+}
+
+template <typename List>
+static void bench_merge(const char* label, size_type n) {
+  List evens, odds;
+  fill(evens, odds, n);
+  size_type before = allocations;
+  double ns = s21_bench::measure_ns([&] { evens.merge(odds); });
+  size_type allocated = allocations - before;
+  s21_bench::do_not_optimize(evens.size());
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s merge (%zu allocs)", label, allocated);
+  s21_bench::report(name, n, ns, 2 * n);
+}
+
+// перенос всего списка, одного узла и диапазона из середины, 1000 раз
+template <typename List>
+static void bench_splice(const char* label, size_type n) {
+  List first, second;
+  fill(first, second, n);
+  const size_type rounds = 1000;
+  size_type before = allocations;
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type r = 0; r < rounds; r++) {
+      first.splice(first.begin(), second);
+      second.splice(second.end(), first, first.begin());
+      auto middle = first.begin();
+      for (int i = 0; i < 16; i++) ++middle;
+      second.splice(second.begin(), first, first.begin(), middle);
+    }
+  });
+  size_type allocated = allocations - before;
+  s21_bench::do_not_optimize(first.size());
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s splice x3 (%zu allocs)", label,
+                allocated);
+  s21_bench::report(name, n, ns, 3 * rounds);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    bench_merge<s21::list<int>>("s21::list<int>", n);
+    bench_merge<std::list<int>>("std::list<int>", n);
+    bench_splice<s21::list<int>>("s21::list<int>", n);
+    bench_splice<std::list<int>>("std::list<int>", n);
+  }
+  return 0;
+}
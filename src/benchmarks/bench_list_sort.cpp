@@ -0,0 +1,54 @@
+#include <list>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+enum class Order { kRandom, kSorted, kReversed, kSawtooth };
+
+static std::vector<int> make_keys(size_type n, Order order) {
+  std::vector<int> keys(n);
+  for (size_type i = 0; i < n; i++) {
+    int value = static_cast<int>(i);
+    if (order == Order::kRandom) {
+      value = static_cast<int>(s21_bench::rng()());
+    } else if (order == Order::kReversed) {
+      value = static_cast<int>(n - i);
+    } else if (order == Order::kSawtooth) {
+      value = static_cast<int>(i % 1000);  // n / 1000 возрастающих серий
+    }
+    keys[i] = value;
+  }
+  return keys;
+}
+
+template <typename List>
+static void bench_sort(const char* label, const char* order_name,
+                       const std::vector<int>& keys) {
+  List l;
+  for (int key : keys) l.push_back(key);
+  double ns = s21_bench::measure_ns([&] { l.sort(); });
+  s21_bench::do_not_optimize(l.front());
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s sort %s", label, order_name);
+  s21_bench::report(name, keys.size(), ns, keys.size());
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 10000000);
+  const std::pair<Order, const char*> orders[] = {
+      {Order::kRandom, "random"},
+      {Order::kSorted, "sorted"},
+      {Order::kReversed, "reversed"},
+      {Order::kSawtooth, "sawtooth"}};
+  for (size_type n = 100000; n <= max_n; n *= 10) {
+    for (const auto& order : orders) {
+      std::vector<int> keys = make_keys(n, order.first);
+      bench_sort<s21::list<int>>("s21::list<int>", order.second, keys);
+      bench_sort<std::list<int>>("std::list<int>", order.second, keys);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,72 @@
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// общий стек свободных буферов под глобальным мьютексом, как сейчас
+class locked_stack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    s_.push(value);
+  }
+  bool try_pop(int& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (s_.empty()) return false;
+    out = s_.top();
+    s_.pop();
+    return true;
+  }
+
+ private:
+  s21::stack<int> s_;
+  std::mutex mutex_;
+};
+
+// каждый поток берет буфер из общего списка (или заводит новый), немного
+// работает и возвращает его обратно
+template <typename Stack>
+static void bench_free_list(const char* label, size_type threads,
+                            size_type count) {
+  Stack s;
+  for (int i = 0; i < 64; i++) s.push(i);
+  size_type per_thread = count / threads;
+  std::atomic<long long> sum(0);
+  double ns = s21_bench::measure_ns([&] {
+    std::vector<std::thread> workers;
+    for (size_type t = 0; t < threads; t++) {
+      workers.emplace_back([&, t] {
+        s21_bench::pin_thread(static_cast<unsigned>(t));
+        long long local = 0;
+        for (size_type i = 0; i < per_thread; i++) {
+          int buffer = static_cast<int>(i);
+          if (s.try_pop(buffer)) local += buffer;
+          s.push(buffer);
+        }
+        sum += local;
+      });
+    }
+    for (auto& worker : workers) worker.join();
+  });
+  s21_bench::do_not_optimize(sum.load());
+  size_type total = per_thread * threads * 2;
+  std::printf("%-32s %2zu threads %10.2f Mop/s\n", label, threads,
+              total / ns * 1000.0);
+}
+
+int main(int argc, char** argv) {
+  size_type count = s21_bench::max_size_arg(argc, argv, 4000000);
+  size_type cores = std::thread::hardware_concurrency();
+  if (cores < 1) cores = 1;
+  for (size_type threads = 1; threads <= cores * 2; threads *= 2) {
+    bench_free_list<s21::lockfree_stack<int>>("lockfree_stack", threads,
+                                              count);
+    bench_free_list<locked_stack>("mutex + s21::stack", threads, count);
+  }
+  return 0;
+}
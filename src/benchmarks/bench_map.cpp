@@ -0,0 +1,114 @@
+#include <map>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// задержка поиска по ключу должна оставаться почти постоянной с ростом n
+static void bench_lookup(size_type max_n) {
+  const size_type lookups = 1000000;
+  for (size_type n = 1000; n <= max_n; n *= 10) {
+    s21::map<int, int> m;
+    for (size_type i = 0; i < n; i++) m.insert(static_cast<int>(i * 2), 0);
+
+    s21::vector<int> keys;
+    std::uniform_int_distribution<size_type> dist(0, n - 1);
+    for (size_type i = 0; i < lookups; i++)
+      keys.push_back(static_cast<int>(dist(s21_bench::rng()) * 2));
+
+    size_type hits = 0;
+    double ns = s21_bench::measure_ns([&] {
+      for (size_type i = 0; i < lookups; i++) hits += m.contains(keys[i]);
+    });
+    s21_bench::do_not_optimize(hits);
+    s21_bench::report("map::contains (hit)", n, ns, lookups);
+
+    ns = s21_bench::measure_ns([&] {
+      for (size_type i = 0; i < lookups; i++) hits += m.contains(keys[i] + 1);
+    });
+    s21_bench::do_not_optimize(hits);
+    s21_bench::report("map::contains (miss)", n, ns, lookups);
+
+    ns = s21_bench::measure_ns([&] {
+      for (size_type i = 0; i < lookups; i++) hits += m.at(keys[i]);
+    });
+    s21_bench::do_not_optimize(hits);
+    s21_bench::report("map::at", n, ns, lookups);
+  }
+}
+
+// begin()/size()/empty() не должны зависеть от n, обход - O(1) на элемент
+static void bench_iterate(size_type max_n) {
+  const size_type n = max_n < 1000000 ? max_n : 1000000;
+  const size_type calls = 1000000;
+  s21::map<int, int> m;
+  for (size_type i = 0; i < n; i++) m.insert(static_cast<int>(i), 1);
+
+  size_type sum = 0;
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < calls; i++) sum += m.size();
+  });
+  s21_bench::do_not_optimize(sum);
+  s21_bench::report("map::size", n, ns, calls);
+
+  ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < calls; i++) sum += m.empty();
+  });
+  s21_bench::do_not_optimize(sum);
+  s21_bench::report("map::empty", n, ns, calls);
+
+  ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < calls; i++) sum += (m.begin() != m.end());
+  });
+  s21_bench::do_not_optimize(sum);
+  s21_bench::report("map::begin", n, ns, calls);
+
+  ns = s21_bench::measure_ns([&] {
+    for (auto it = m.begin(); it != m.end(); ++it) sum += it.getValue();
+  });
+  s21_bench::do_not_optimize(sum);
+  s21_bench::report("map iteration (per element)", n, ns, n);
+}
+
+// вставка, удаление и очистка: по узлу через new/delete против пула
+template <typename Map>
+static void bench_churn(const char* label, size_type n) {
+  s21::vector<int> keys;
+  for (size_type i = 0; i < n; i++) keys.push_back(static_cast<int>(i));
+  for (size_type i = n - 1; i > 0; i--) {
+    std::uniform_int_distribution<size_type> dist(0, i);
+    std::swap(keys[i], keys[dist(s21_bench::rng())]);
+  }
+
+  Map m;
+  char name[64];
+  for (int round = 0; round < 2; round++) {
+    double ns = s21_bench::measure_ns([&] {
+      for (size_type i = 0; i < n; i++) m.insert(keys[i], 0);
+    });
+    std::snprintf(name, sizeof(name), "%s insert (round %d)", label, round);
+    s21_bench::report(name, n, ns, n);
+
+    ns = s21_bench::measure_ns([&] {
+      for (size_type i = 0; i < n / 2; i++) m.erase(m.find(keys[i]));
+    });
+    std::snprintf(name, sizeof(name), "%s erase (round %d)", label, round);
+    s21_bench::report(name, n, ns, n / 2);
+
+    size_type left = m.size();
+    ns = s21_bench::measure_ns([&] { m.clear(); });
+    std::snprintf(name, sizeof(name), "%s clear (round %d)", label, round);
+    s21_bench::report(name, n, ns, left);
+  }
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 10000000);
+  bench_lookup(max_n);
+  bench_iterate(max_n);
+  const size_type churn_n = max_n < 1000000 ? max_n : 1000000;
+  bench_churn<s21::map<int, int>>("map new/delete", churn_n);
+  bench_churn<s21::map<int, int, s21::pool_allocator>>("map pool", churn_n);
+  return 0;
+}
@@ -0,0 +1,99 @@
+#include <map>
+#include <vector>
+
+#include "../containers/s21_map.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// ключи first, first + step, ... - n штук
+template <typename Map>
+static void fill(Map& m, size_type n, int first, int step) {
+  for (size_type i = 0; i < n; i++) {
+    int key = first + static_cast<int>(i) * step;
+    m.insert({key, key});
+  }
+}
+
+// копия конструктором копирования; разрушение копии не меряется
+template <typename Map>
+static void bench_copy(const char* label, size_type n) {
+  Map source;
+  fill(source, n, 0, 1);
+  Map* copy = nullptr;
+  double best = 0;
+  for (int round = 0; round < 3; round++) {
+    double ns = s21_bench::measure_ns([&] { copy = new Map(source); });
+    s21_bench::do_not_optimize(copy->size());
+    delete copy;
+    if (round == 0 || ns < best) best = ns;
+  }
+  s21_bench::report(label, n, best, n);
+}
+
+// как раньше копировал s21::map: вставка по одному с балансировкой
+static void bench_copy_by_insert(size_type n) {
+  s21::map<int, int> source;
+  fill(source, n, 0, 1);
+  s21::map<int, int> copy;
+  double ns = s21_bench::measure_ns([&] {
+    for (auto item : source) copy.insert(item.first, item.second);
+  });
+  s21_bench::do_not_optimize(copy.size());
+  s21_bench::report("s21::map copy by insert", n, ns, n);
+}
+
+// предыдущий замер освободил миллионы узлов; первое крупное выделение
+// после этого сливает их свободные блоки в куче (в glibc это
+// malloc_consolidate) и стоит десятки мс - платим это до замера
+static void settle_heap() {
+  std::vector<char> block(1 << 16);
+  s21_bench::do_not_optimize(block.data());
+}
+
+// слияние двух карт: other_n ключей вперемешку с n ключами приемника
+template <typename Map>
+static void bench_merge(const char* label, size_type n, size_type other_n) {
+  Map target, other;
+  fill(target, n, 0, 2);
+  int step = static_cast<int>(2 * n / other_n) | 1;  // нечетные ключи
+  fill(other, other_n, 1, step);
+  settle_heap();
+  double ns = s21_bench::measure_ns([&] { target.merge(other); });
+  s21_bench::do_not_optimize(target.size());
+  char name[80];
+  std::snprintf(name, sizeof(name), "%s merge %zu", label, other_n);
+  s21_bench::report(name, n, ns, other_n);
+}
+
+// прежний rbtree::merge: вставка каждого элемента other
+static void bench_merge_by_insert(size_type n, size_type other_n) {
+  s21::map<int, int> target, other;
+  fill(target, n, 0, 2);
+  int step = static_cast<int>(2 * n / other_n) | 1;
+  fill(other, other_n, 1, step);
+  settle_heap();
+  double ns = s21_bench::measure_ns([&] {
+    for (auto item : other) target.insert(item.first, item.second);
+    other.clear();
+  });
+  s21_bench::do_not_optimize(target.size());
+  char name[80];
+  std::snprintf(name, sizeof(name), "s21::map merge by insert %zu", other_n);
+  s21_bench::report(name, n, ns, other_n);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    bench_copy<s21::map<int, int>>("s21::map copy", n);
+    bench_copy_by_insert(n);
+    bench_copy<std::map<int, int>>("std::map copy", n);
+    for (size_type other_n : {n, n / 1000}) {
+      bench_merge<s21::map<int, int>>("s21::map", n, other_n);
+      bench_merge_by_insert(n, other_n);
+      bench_merge<std::map<int, int>>("std::map", n, other_n);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,65 @@
+#include <map>
+#include <vector>
+
+#include "../containers/s21_map.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// n ключей: sorted - по возрастанию, nearly - по возрастанию, но каждый
+// десятый переставлен на несколько позиций назад, random - случайные
+static std::vector<int> make_stream(const char* kind, size_type n) {
+  std::vector<int> keys(n);
+  for (size_type i = 0; i < n; i++) keys[i] = static_cast<int>(i);
+  if (kind[0] == 'n') {
+    for (size_type i = 10; i < n; i += 10) {
+      std::swap(keys[i], keys[i - 1 - s21_bench::rng()() % 8]);
+    }
+  } else if (kind[0] == 'r') {
+    for (int& key : keys) key = static_cast<int>(s21_bench::rng()());
+  }
+  return keys;
+}
+
+template <typename Map, typename Insert>
+static void bench_stream(const char* label, const char* kind,
+                         const std::vector<int>& keys, Insert insert) {
+  double best = 0;
+  for (int round = 0; round < 3; round++) {
+    Map m;
+    double ns = s21_bench::measure_ns([&] { insert(m, keys); });
+    s21_bench::do_not_optimize(m.size());
+    if (round == 0 || ns < best) best = ns;
+  }
+  char name[80];
+  std::snprintf(name, sizeof(name), "%s %s", label, kind);
+  s21_bench::report(name, keys.size(), best, keys.size());
+}
+
+template <typename Map>
+static void insert_plain(Map& m, const std::vector<int>& keys) {
+  for (int key : keys) m.insert({key, key});
+}
+// подсказка end(): поток, который в основном растет
+template <typename Map>
+static void insert_end(Map& m, const std::vector<int>& keys) {
+  for (int key : keys) m.insert(m.end(), {key, key});
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    for (const char* kind : {"sorted", "nearly", "random"}) {
+      std::vector<int> keys = make_stream(kind, n);
+      using ours = s21::map<int, int>;
+      using theirs = std::map<int, int>;
+      bench_stream<ours>("s21::map insert", kind, keys, insert_plain<ours>);
+      bench_stream<ours>("s21::map hint end", kind, keys, insert_end<ours>);
+      bench_stream<theirs>("std::map insert", kind, keys,
+                           insert_plain<theirs>);
+      bench_stream<theirs>("std::map hint end", kind, keys,
+                           insert_end<theirs>);
+    }
+  }
+  return 0;
+}
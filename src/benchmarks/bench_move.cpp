@@ -0,0 +1,101 @@
+#include <string>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// тяжелый элемент, считающий свои копирования и перемещения
+struct Tracked {
+  static size_type copies;
+  static size_type moves;
+
+  Tracked() = default;
+  Tracked(int id, size_type length) : payload(length, 'a' + id % 26) {}
+  Tracked(const Tracked& other) : payload(other.payload) { copies++; }
+  Tracked(Tracked&& other) noexcept : payload(std::move(other.payload)) {
+    moves++;
+  }
+  Tracked& operator=(const Tracked& other) {
+    payload = other.payload;
+    copies++;
+    return *this;
+  }
+  Tracked& operator=(Tracked&& other) noexcept {
+    payload = std::move(other.payload);
+    moves++;
+    return *this;
+  }
+
+  std::string payload;
+};
+size_type Tracked::copies = 0;
+size_type Tracked::moves = 0;
+
+static const size_type kPayload = 64;  // больше SSO: копия - это аллокация
+
+enum class Mode { kLvalue, kRvalue, kEmplace };
+
+// одна вставка в конец в выбранном режиме; у stack/queue это push/emplace
+template <typename C>
+static void put(C& c, Mode mode, int id) {
+  if (mode == Mode::kLvalue) {
+    Tracked value(id, kPayload);
+    c.push(value);
+  } else if (mode == Mode::kRvalue) {
+    c.push(Tracked(id, kPayload));
+  } else {
+    c.emplace(id, kPayload);
+  }
+}
+template <>
+void put(s21::vector<Tracked>& c, Mode mode, int id) {
+  if (mode == Mode::kLvalue) {
+    Tracked value(id, kPayload);
+    c.push_back(value);
+  } else if (mode == Mode::kRvalue) {
+    c.push_back(Tracked(id, kPayload));
+  } else {
+    c.emplace_back(id, kPayload);
+  }
+}
+template <>
+void put(s21::list<Tracked>& c, Mode mode, int id) {
+  if (mode == Mode::kLvalue) {
+    Tracked value(id, kPayload);
+    c.push_back(value);
+  } else if (mode == Mode::kRvalue) {
+    c.push_back(Tracked(id, kPayload));
+  } else {
+    c.emplace_back(id, kPayload);
+  }
+}
+
+template <typename C>
+static void bench(const char* label, size_type n) {
+  static const char* kModes[] = {"push(lvalue)", "push(rvalue)", "emplace"};
+  for (Mode mode : {Mode::kLvalue, Mode::kRvalue, Mode::kEmplace}) {
+    Tracked::copies = Tracked::moves = 0;
+    double ns = s21_bench::measure_ns([&] {
+      C c;
+      for (size_type i = 0; i < n; i++) put(c, mode, static_cast<int>(i));
+      s21_bench::do_not_optimize(c);
+    });
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s %s", label,
+                  kModes[static_cast<int>(mode)]);
+    s21_bench::report(name, n, ns, n);
+    std::printf("%-40s copies/el=%.2f moves/el=%.2f\n", "",
+                static_cast<double>(Tracked::copies) / n,
+                static_cast<double>(Tracked::moves) / n);
+  }
+}
+
+int main(int argc, char** argv) {
+  size_type n = s21_bench::max_size_arg(argc, argv, 1000000);
+  bench<s21::vector<Tracked>>("s21::vector", n);
+  bench<s21::list<Tracked>>("s21::list", n);
+  bench<s21::stack<Tracked>>("s21::stack", n);
+  bench<s21::queue<Tracked>>("s21::queue", n);
+  return 0;
+}
@@ -0,0 +1,91 @@
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// блокирующая очередь на мьютексе вокруг s21::queue для сравнения
+class locked_queue {
+ public:
+  explicit locked_queue(size_type capacity) : capacity_(capacity) {}
+  bool push(int value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return closed_ || q_.size() < capacity_; });
+    if (closed_) return false;
+    q_.push(value);
+    not_empty_.notify_one();
+    return true;
+  }
+  bool pop(int& out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return closed_ || !q_.empty(); });
+    if (q_.empty()) return false;
+    out = q_.front();
+    q_.pop();
+    not_full_.notify_one();
+    return true;
+  }
+  void close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_full_.notify_all();
+    not_empty_.notify_all();
+  }
+
+ private:
+  s21::queue<int> q_;
+  size_type capacity_;
+  bool closed_ = false;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+
+// threads производителей и столько же потребителей, блокирующие push/pop
+template <typename Queue>
+static void bench_scaling(const char* label, size_type threads,
+                          size_type count) {
+  Queue q(1024);
+  size_type per_producer = count / threads;
+  std::atomic<long long> sum(0);
+  double ns = s21_bench::measure_ns([&] {
+    std::vector<std::thread> workers;
+    for (size_type t = 0; t < threads; t++) {
+      workers.emplace_back([&, t] {
+        s21_bench::pin_thread(static_cast<unsigned>(t * 2));
+        for (size_type i = 0; i < per_producer; i++)
+          q.push(static_cast<int>(i));
+      });
+      workers.emplace_back([&, t] {
+        s21_bench::pin_thread(static_cast<unsigned>(t * 2 + 1));
+        long long local = 0;
+        int value;
+        while (q.pop(value)) local += value;
+        sum += local;
+      });
+    }
+    for (size_type t = 0; t < threads; t++) workers[t * 2].join();
+    q.close();
+    for (size_type t = 0; t < threads; t++) workers[t * 2 + 1].join();
+  });
+  s21_bench::do_not_optimize(sum.load());
+  size_type total = per_producer * threads;
+  std::printf("%-32s %2zu x %-2zu threads %10.2f Mmsg/s\n", label, threads,
+              threads, total / ns * 1000.0);
+}
+
+int main(int argc, char** argv) {
+  size_type count = s21_bench::max_size_arg(argc, argv, 4000000);
+  size_type cores = std::thread::hardware_concurrency();
+  if (cores < 2) cores = 2;
+  for (size_type threads = 1; threads <= cores / 2 || threads == 1;
+       threads *= 2) {
+    bench_scaling<s21::mpmc_queue<int>>("mpmc_queue", threads, count);
+    bench_scaling<locked_queue>("mutex + s21::queue", threads, count);
+  }
+  return 0;
+}
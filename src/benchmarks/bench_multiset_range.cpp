@@ -0,0 +1,73 @@
+#include <set>
+#include <vector>
+
+#include "../containersplus/s21_multiset.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// сколько элементов в [lo, lo + width): lower_bound и проход до upper_bound
+template <typename Multiset>
+static size_type range_count(Multiset& m, int lo, int width) {
+  size_type found = 0;
+  auto last = m.lower_bound(lo + width);
+  for (auto it = m.lower_bound(lo); it != last; ++it) found++;
+  return found;
+}
+
+// queries запросов по диапазонам ключей ширины width: чем шире, тем больше
+// доля попавших элементов (selectivity)
+template <typename Multiset>
+static void bench_range(const char* label, Multiset& m, size_type n,
+                        int key_space, int width, size_type queries) {
+  std::vector<int> starts(queries);
+  for (int& lo : starts) {
+    lo = static_cast<int>(s21_bench::rng()() % key_space);
+  }
+  size_type found = 0;
+  double ns = s21_bench::measure_best_ns(3, [&] {
+    for (int lo : starts) found += range_count(m, lo, width);
+  });
+  s21_bench::do_not_optimize(found);
+  char name[80];
+  std::snprintf(name, sizeof(name), "%s range %.4f%%", label,
+                100.0 * width / key_space);
+  s21_bench::report(name, n, ns, queries);
+}
+
+// count по одному ключу с ~n / key_space копиями
+template <typename Multiset>
+static void bench_count(const char* label, Multiset& m, size_type n,
+                        int key_space, size_type queries) {
+  size_type found = 0;
+  double ns = s21_bench::measure_best_ns(3, [&] {
+    for (size_type i = 0; i < queries; i++)
+      found += m.count(static_cast<int>(i * 7919 % key_space));
+  });
+  s21_bench::do_not_optimize(found);
+  char name[80];
+  std::snprintf(name, sizeof(name), "%s count", label);
+  s21_bench::report(name, n, ns, queries);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    const int key_space = static_cast<int>(n / 4);  // ~4 копии ключа
+    s21::multiset<int> ours;
+    std::multiset<int> theirs;
+    for (size_type i = 0; i < n; i++) {
+      int key = static_cast<int>(s21_bench::rng()() % key_space);
+      ours.insert(key);
+      theirs.insert(key);
+    }
+    const size_type queries = 10000;
+    for (int width : {1, key_space / 1000 + 1, key_space / 100 + 1}) {
+      bench_range("s21::multiset", ours, n, key_space, width, queries);
+      bench_range("std::multiset", theirs, n, key_space, width, queries);
+    }
+    bench_count("s21::multiset", ours, n, key_space, queries);
+    bench_count("std::multiset", theirs, n, key_space, queries);
+  }
+  return 0;
+}
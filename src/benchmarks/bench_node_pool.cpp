@@ -0,0 +1,82 @@
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// элемент с данными вне SSO: узел и строка - две разные аллокации
+static std::string make_value(size_type i) {
+  return std::string(40, static_cast<char>('a' + i % 26));
+}
+
+static void print(const char* label, const char* what, size_type n, double ns,
+                  size_type ops, size_type rss_before) {
+  char name[96];
+  std::snprintf(name, sizeof(name), "%s %s (rss +%zu KB)", label, what,
+                s21_bench::rss_kb() - rss_before);
+  s21_bench::report(name, n, ns, ops);
+}
+
+// долгоживущая нагрузка очереди задач: kLists списков, в один случайный
+// добавляется элемент, из другого забирается; живых узлов около n.
+// Все списки - копии List(alloc), поэтому с общим пулом делят его
+template <typename List, typename Alloc>
+static void bench_list_churn(const char* label, size_type n, size_type ops,
+                             const Alloc& alloc) {
+  const size_type kLists = 64;
+  std::vector<List> lists(kLists, List(alloc));
+  for (size_type i = 0; i < n; i++) lists[i % kLists].push_back(make_value(i));
+  // рост памяти считается после заполнения: живых узлов дальше не больше
+  size_type rss_before = s21_bench::rss_kb();
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < ops; i++) {
+      unsigned r = static_cast<unsigned>(s21_bench::rng()());
+      lists[r % kLists].push_back(make_value(i));
+      List& victim = lists[(r >> 8) % kLists];
+      if (!victim.empty()) victim.pop_front();
+    }
+  });
+  s21_bench::do_not_optimize(lists[0].size());
+  print(label, "churn", n, ns, ops, rss_before);
+}
+
+// стек растет пачками и опустошается, как при обходе в глубину
+template <typename Stack>
+static void bench_stack_churn(const char* label, size_type n, size_type ops) {
+  Stack s;
+  for (size_type i = 0; i < n; i++) s.push(static_cast<int>(i));
+  for (size_type i = 0; i < n; i++) s.pop();
+  size_type rss_before = s21_bench::rss_kb();
+  size_type done = 0;
+  double ns = s21_bench::measure_ns([&] {
+    while (done < ops) {
+      size_type burst = 1 + s21_bench::rng()() % n;
+      for (size_type i = 0; i < burst; i++) s.push(static_cast<int>(i));
+      for (size_type i = 0; i < burst; i++) s.pop();
+      done += 2 * burst;
+    }
+  });
+  s21_bench::do_not_optimize(s.size());
+  print(label, "push/pop", n, ns, done, rss_before);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  const size_type ops = 10000000;
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    s21::shared_pool pool;
+    bench_list_churn<s21::list<std::string, s21::shared_pool_allocator>>(
+        "list shared pool", n, ops, s21::shared_pool_allocator(pool));
+    bench_list_churn<s21::list<std::string, s21::pool_allocator>>(
+        "list pool", n, ops, s21::pool_allocator());
+    bench_list_churn<s21::list<std::string>>("list new/delete", n, ops,
+                                             s21::node_allocator());
+    bench_stack_churn<s21::stack<int, s21::list<int, s21::pool_allocator>>>(
+        "stack<list> pool", n, ops);
+    bench_stack_churn<s21::stack<int, s21::list<int>>>("stack<list> new/delete",
+                                                       n, ops);
+  }
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include <set>
+#include <vector>
+
+#include "../containersplus/s21_multiset.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+using ranked_multiset = s21::multiset<int, s21::node_allocator, true>;
+
+// перцентиль p окна: k-й элемент через nth за O(log n)
+static int percentile_nth(ranked_multiset& window, double p) {
+  return *window.nth(static_cast<size_type>(p * (window.size() - 1)));
+}
+// то же проходом от начала, как приходилось делать без nth
+template <typename Multiset>
+static int percentile_walk(Multiset& window, double p) {
+  size_type k = static_cast<size_type>(p * (window.size() - 1));
+  auto it = window.begin();
+  while (k-- > 0) ++it;
+  return *it;
+}
+
+// скользящее окно из n последних значений: шаг - вставка нового, удаление
+// самого старого и запрос p50, p90 и p99
+template <typename Multiset, typename Query>
+static void bench_rolling(const char* label, size_type n, size_type steps,
+                          Query query) {
+  std::vector<int> stream(n + steps);
+  for (int& value : stream) {
+    value = static_cast<int>(s21_bench::rng()() % 1000000);
+  }
+  Multiset window;
+  for (size_type i = 0; i < n; i++) window.insert(stream[i]);
+
+  long long sum = 0;
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type i = n; i < n + steps; i++) {
+      window.insert(stream[i]);
+      window.erase(window.find(stream[i - n]));
+      sum += query(window, 0.5) + query(window, 0.9) + query(window, 0.99);
+    }
+  });
+  s21_bench::do_not_optimize(sum);
+  s21_bench::report(label, n, ns, steps);
+}
+
+// только nth и rank, без изменения дерева
+static void bench_queries(size_type n) {
+  ranked_multiset m;
+  for (size_type i = 0; i < n; i++) {
+    m.insert(static_cast<int>(s21_bench::rng()() % 1000000));
+  }
+  const size_type queries = 100000;
+  size_type sum = 0;
+  double ns = s21_bench::measure_best_ns(3, [&] {
+    for (size_type i = 0; i < queries; i++) sum += *m.nth(i * 7919 % n);
+  });
+  s21_bench::report("ranked multiset nth", n, ns, queries);
+  ns = s21_bench::measure_best_ns(3, [&] {
+    for (size_type i = 0; i < queries; i++)
+      sum += m.rank(static_cast<int>(i * 7919 % 1000000));
+  });
+  s21_bench::do_not_optimize(sum);
+  s21_bench::report("ranked multiset rank", n, ns, queries);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    bench_queries(n);
+    bench_rolling<ranked_multiset>("rolling p50/p90/p99 nth", n, 100000,
+                                   percentile_nth);
+    // проход от начала - O(n) на запрос, поэтому шагов меньше
+    size_type walk_steps = n >= 1000000 ? 100 : 1000;
+    bench_rolling<s21::multiset<int>>("rolling s21 walk", n, walk_steps,
+                                      percentile_walk<s21::multiset<int>>);
+    bench_rolling<std::multiset<int>>("rolling std walk", n, walk_steps,
+                                      percentile_walk<std::multiset<int>>);
+  }
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+template <size_type Arity>
+using DaryQueue =
+    s21::priority_queue<int, s21::vector<int>, std::less<int>, Arity>;
+
+// очередь из n элементов, затем ops операций: push с вероятностью
+// push_percent, иначе pop; в конце все снимается
+template <typename Queue>
+static void bench_mix(const char* label, size_type n, size_type ops,
+                      unsigned push_percent, const std::vector<int>& keys) {
+  double ns = s21_bench::measure_best_ns(3, [&] {
+    Queue q;
+    for (size_type i = 0; i < n; i++) q.push(keys[i]);
+    long long sum = 0;
+    for (size_type i = 0; i < ops; i++) {
+      int key = keys[i % keys.size()];
+      if (static_cast<unsigned>(key) % 100 < push_percent || q.empty()) {
+        q.push(key);
+      } else {
+        sum += q.top();
+        q.pop();
+      }
+    }
+    while (!q.empty()) {
+      sum += q.top();
+      q.pop();
+    }
+    s21_bench::do_not_optimize(sum);
+  });
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s mix %u%% push", label, push_percent);
+  s21_bench::report(name, n, ns, n + ops);
+}
+
+// построение из диапазона за O(n) против n вставок
+template <typename Queue>
+static void bench_heapify(const char* label, const std::vector<int>& keys) {
+  double ns = s21_bench::measure_best_ns(3, [&] {
+    Queue q(keys.begin(), keys.end());
+    s21_bench::do_not_optimize(q.top());
+  });
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s heapify", label);
+  s21_bench::report(name, keys.size(), ns, keys.size());
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    std::vector<int> keys(n);
+    for (int& key : keys) key = static_cast<int>(s21_bench::rng()() >> 33);
+    for (unsigned push_percent : {50u, 75u}) {
+      bench_mix<std::priority_queue<int>>("std::priority_queue", n, n,
+                                          push_percent, keys);
+      bench_mix<DaryQueue<2>>("s21::priority_queue d=2", n, n, push_percent,
+                              keys);
+      bench_mix<DaryQueue<4>>("s21::priority_queue d=4", n, n, push_percent,
+                              keys);
+      bench_mix<DaryQueue<8>>("s21::priority_queue d=8", n, n, push_percent,
+                              keys);
+    }
+    bench_heapify<std::priority_queue<int>>("std::priority_queue", keys);
+    bench_heapify<DaryQueue<2>>("s21::priority_queue d=2", keys);
+    bench_heapify<DaryQueue<4>>("s21::priority_queue d=4", keys);
+  }
+  return 0;
+}
@@ -0,0 +1,59 @@
+#include <queue>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// производитель и потребитель по очереди: в очереди всегда ~depth элементов
+template <typename Queue>
+static void bench_steady(const char* label, size_type depth, size_type ops) {
+  Queue q;
+  for (size_type i = 0; i < depth; i++) q.push(static_cast<int>(i));
+
+  long long sum = 0;
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < ops; i++) {
+      q.push(static_cast<int>(i));
+      sum += q.front();
+      q.pop();
+    }
+  });
+  s21_bench::do_not_optimize(sum);
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s steady push+pop", label);
+  s21_bench::report(name, depth, ns, ops);
+}
+
+// пачками: burst элементов внутрь, затем все наружу
+template <typename Queue>
+static void bench_bursts(const char* label, size_type burst, size_type ops) {
+  Queue q;
+  long long sum = 0;
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type done = 0; done < ops; done += burst) {
+      for (size_type i = 0; i < burst; i++) q.push(static_cast<int>(i));
+      while (!q.empty()) {
+        sum += q.front();
+        q.pop();
+      }
+    }
+  });
+  s21_bench::do_not_optimize(sum);
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s burst push/pop", label);
+  s21_bench::report(name, burst, ns, ops);
+}
+
+int main(int argc, char** argv) {
+  size_type ops = s21_bench::max_size_arg(argc, argv, 10000000);
+  for (size_type depth : {16, 1024, 65536}) {
+    bench_steady<s21::queue<int>>("s21::queue", depth, ops);
+    bench_steady<std::queue<int>>("std::queue", depth, ops);
+  }
+  for (size_type burst : {64, 4096, 262144}) {
+    bench_bursts<s21::queue<int>>("s21::queue", burst, ops);
+    bench_bursts<std::queue<int>>("std::queue", burst, ops);
+  }
+  return 0;
+}
@@ -0,0 +1,145 @@
+#include <mutex>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// очередь под мьютексом - то, чем пользовались до spsc_queue
+struct locked_queue {
+  bool try_push(long long value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    q.push(value);
+    return true;
+  }
+  bool try_pop(long long& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (q.empty()) return false;
+    out = q.front();
+    q.pop();
+    return true;
+  }
+  bool empty() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return q.empty();
+  }
+  std::mutex mutex;
+  s21::queue<long long> q;
+};
+
+// сообщений в секунду между двумя привязанными к ядрам потоками
+template <typename Queue>
+static void bench_throughput(const char* label, Queue& q, size_type count) {
+  long long sum = 0;
+  double ns = s21_bench::measure_ns([&] {
+    std::thread producer([&] {
+      s21_bench::pin_thread(0);
+      for (size_type i = 0; i < count; i++) {
+        while (!q.try_push(static_cast<long long>(i)))
+          s21_bench::spin_pause();
+      }
+    });
+    s21_bench::pin_thread(1);
+    long long value;
+    for (size_type i = 0; i < count;) {
+      if (q.try_pop(value)) {
+        sum += value;
+        i++;
+      } else {
+        s21_bench::spin_pause();
+      }
+    }
+    producer.join();
+  });
+  s21_bench::do_not_optimize(sum);
+  std::printf("%-40s n=%-10zu %12.2f Mmsg/s\n", label, count,
+              count / ns * 1000.0);
+}
+
+// пачками по 32 сообщения
+static void bench_batched(size_type count) {
+  s21::spsc_queue<long long> q(4096);
+  const size_type batch = 32;
+  long long sum = 0;
+  double ns = s21_bench::measure_ns([&] {
+    std::thread producer([&] {
+      s21_bench::pin_thread(0);
+      long long buffer[batch];
+      for (size_type sent = 0; sent < count;) {
+        for (size_type i = 0; i < batch; i++)
+          buffer[i] = static_cast<long long>(sent + i);
+        size_type n = count - sent < batch ? count - sent : batch;
+        for (size_type done = 0; done < n;) {
+          size_type pushed = q.try_push_n(buffer + done, n - done);
+          if (pushed == 0) s21_bench::spin_pause();
+          done += pushed;
+        }
+        sent += n;
+      }
+    });
+    s21_bench::pin_thread(1);
+    long long buffer[batch];
+    for (size_type got = 0; got < count;) {
+      size_type n = q.try_pop_n(buffer, batch);
+      if (n == 0) s21_bench::spin_pause();
+      for (size_type i = 0; i < n; i++) sum += buffer[i];
+      got += n;
+    }
+    producer.join();
+  });
+  s21_bench::do_not_optimize(sum);
+  std::printf("%-40s n=%-10zu %12.2f Mmsg/s\n",
+              "spsc_queue try_push_n/try_pop_n", count, count / ns * 1000.0);
+}
+
+// задержка передачи: производитель кладет метку времени и ждет, пока
+// потребитель ее заберет, потребитель считает разницу
+template <typename Queue>
+static void bench_latency(const char* label, Queue& q, size_type count) {
+  std::vector<long long> samples;
+  samples.reserve(count);
+  std::thread producer([&] {
+    s21_bench::pin_thread(0);
+    for (size_type i = 0; i < count; i++) {
+      while (!q.try_push(s21_bench::now_ns())) s21_bench::spin_pause();
+      while (!q.empty()) s21_bench::spin_pause();
+    }
+  });
+  s21_bench::pin_thread(1);
+  long long stamp;
+  for (size_type i = 0; i < count;) {
+    if (q.try_pop(stamp)) {
+      samples.push_back(s21_bench::now_ns() - stamp);
+      i++;
+    } else {
+      s21_bench::spin_pause();
+    }
+  }
+  producer.join();
+  long long p50 = s21_bench::percentile(samples, 50);
+  long long p99 = s21_bench::percentile(samples, 99);
+  std::printf("%-40s n=%-10zu p50 %6lld ns  p99 %6lld ns\n", label, count, p50,
+              p99);
+}
+
+int main(int argc, char** argv) {
+  size_type count = s21_bench::max_size_arg(argc, argv, 10000000);
+  {
+    s21::spsc_queue<long long> q(4096);
+    bench_throughput("spsc_queue try_push/try_pop", q, count);
+  }
+  bench_batched(count);
+  {
+    locked_queue q;
+    bench_throughput("mutex + s21::queue", q, count);
+  }
+  {
+    s21::spsc_queue<long long> q(4096);
+    bench_latency("spsc_queue handoff latency", q, count / 100);
+  }
+  {
+    locked_queue q;
+    bench_latency("mutex + s21::queue handoff latency", q, count / 100);
+  }
+  return 0;
+}
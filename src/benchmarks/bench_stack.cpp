@@ -0,0 +1,70 @@
+#include <string>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+using ListStack = s21::stack<int, s21::list<int>>;
+using PooledListStack = s21::stack<int, s21::list<int, s21::pool_allocator>>;
+
+static void print(const char* label, const char* what, size_type n, double ns,
+                  long long misses) {
+  char name[80];
+  if (misses < 0) {
+    std::snprintf(name, sizeof(name), "%s %s", label, what);
+  } else {
+    std::snprintf(name, sizeof(name), "%s %s (%.3f miss/op)", label, what,
+                  static_cast<double>(misses) / n);
+  }
+  s21_bench::report(name, n, ns, n);
+}
+
+// n push, затем n pop; промахи кэша считаются по каждой фазе отдельно
+template <typename Stack>
+static void bench_push_pop(const char* label, size_type n) {
+  Stack s;
+  double ns = 0;
+  long long misses = s21_bench::count_cache_misses([&] {
+    ns = s21_bench::measure_ns([&] {
+      for (size_type i = 0; i < n; i++) s.push(static_cast<int>(i));
+    });
+  });
+  print(label, "push", n, ns, misses);
+
+  long long sum = 0;
+  misses = s21_bench::count_cache_misses([&] {
+    ns = s21_bench::measure_ns([&] {
+      for (size_type i = 0; i < n; i++) {
+        sum += s.top();
+        s.pop();
+      }
+    });
+  });
+  s21_bench::do_not_optimize(sum);
+  print(label, "pop", n, ns, misses);
+}
+
+// копия заполненного стека
+template <typename Stack>
+static void bench_copy(const char* label, size_type n) {
+  Stack s;
+  for (size_type i = 0; i < n; i++) s.push(static_cast<int>(i));
+  double ns = s21_bench::measure_best_ns(3, [&] {
+    Stack copy(s);
+    s21_bench::do_not_optimize(copy.top());
+  });
+  print(label, "copy", n, ns, -1);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 10000000);
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    bench_push_pop<s21::stack<int>>("stack<vector>", n);
+    bench_push_pop<ListStack>("stack<list>", n);
+    bench_push_pop<PooledListStack>("stack<list> pool", n);
+    bench_copy<s21::stack<int>>("stack<vector>", n);
+    bench_copy<ListStack>("stack<list>", n);
+  }
+  return 0;
+}
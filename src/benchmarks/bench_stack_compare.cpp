@@ -0,0 +1,75 @@
+#include <cstdlib>
+#include <new>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// счетчик выделений памяти: сравнение не должно выделять ничего
+static size_type allocations = 0;
+
+void* operator new(std::size_t size) {
+  allocations++;
+  if (void* ptr = std::malloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+// прежний способ: копии обоих стеков снимаются поэлементно
+template <typename Stack>
+static bool equal_by_copy(const Stack& lhs, const Stack& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  Stack temp1 = lhs;
+  Stack temp2 = rhs;
+  while (!temp1.empty()) {
+    if (temp1.top() != temp2.top()) return false;
+    temp1.pop();
+    temp2.pop();
+  }
+  return true;
+}
+
+template <typename Stack, typename Equal>
+static void bench_equal(const char* label, const char* how, size_type n,
+                        bool mismatch_at_bottom, Equal equal) {
+  Stack a, b;
+  for (size_type i = 0; i < n; i++) {
+    a.push(static_cast<int>(i));
+    b.push(static_cast<int>(i) + (mismatch_at_bottom && i == 0));
+  }
+  const size_type rounds = 10;
+  size_type before = allocations;
+  size_type hits = 0;
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type r = 0; r < rounds; r++) hits += equal(a, b);
+  });
+  size_type allocated = (allocations - before) / rounds;
+  s21_bench::do_not_optimize(hits);
+  char name[80];
+  std::snprintf(name, sizeof(name), "%s %s %s (%zu allocs)", label, how,
+                mismatch_at_bottom ? "mismatch" : "equal", allocated);
+  s21_bench::report(name, n, ns, rounds);
+}
+
+template <typename Stack>
+static void run(const char* label, size_type n) {
+  auto in_place = [](const Stack& a, const Stack& b) { return a == b; };
+  auto by_copy = [](const Stack& a, const Stack& b) {
+    return equal_by_copy(a, b);
+  };
+  for (bool mismatch : {false, true}) {
+    bench_equal<Stack>(label, "==", n, mismatch, in_place);
+    bench_equal<Stack>(label, "copy+pop", n, mismatch, by_copy);
+  }
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    run<s21::stack<int>>("stack<vector>", n);
+    run<s21::stack<int, s21::list<int>>>("stack<list>", n);
+  }
+  return 0;
+}
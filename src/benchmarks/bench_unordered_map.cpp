@@ -0,0 +1,73 @@
+#include <unordered_map>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+using s21_map = s21::map<int, int>;
+using s21_hash = s21::unordered_map<int, int>;
+using std_hash = std::unordered_map<int, int>;
+
+// единый интерфейс поиска и удаления по ключу для трех контейнеров
+static bool has(s21_map& m, int key) { return m.contains(key); }
+static bool has(s21_hash& m, int key) { return m.contains(key); }
+static bool has(std_hash& m, int key) { return m.count(key) != 0; }
+
+static size_type erase_key(s21_hash& m, int key) { return m.erase(key); }
+static size_type erase_key(std_hash& m, int key) { return m.erase(key); }
+static size_type erase_key(s21_map& m, int key) {
+  auto it = m.find(key);
+  if (it == m.end()) return 0;
+  m.erase(it);
+  return 1;
+}
+
+// попадания, промахи и чередование вставки/удаления
+template <typename Map>
+static void bench_workloads(const char* label, size_type n) {
+  s21::vector<int> keys;
+  for (size_type i = 0; i < n; i++)
+    keys.push_back(static_cast<int>(s21_bench::rng()() >> 33) * 2);
+
+  Map m;
+  char name[64];
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < n; i++) m.insert({keys[i], keys[i]});
+  });
+  std::snprintf(name, sizeof(name), "%s insert", label);
+  s21_bench::report(name, n, ns, n);
+
+  size_type found = 0;
+  ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < n; i++) found += has(m, keys[n - 1 - i]);
+  });
+  s21_bench::do_not_optimize(found);
+  std::snprintf(name, sizeof(name), "%s lookup hit", label);
+  s21_bench::report(name, n, ns, n);
+
+  ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < n; i++) found += has(m, keys[i] + 1);
+  });
+  s21_bench::do_not_optimize(found);
+  std::snprintf(name, sizeof(name), "%s lookup miss", label);
+  s21_bench::report(name, n, ns, n);
+
+  ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < n; i++) {
+      found += erase_key(m, keys[i]);
+      m.insert({keys[i] + 1, 0});
+    }
+  });
+  s21_bench::do_not_optimize(found);
+  std::snprintf(name, sizeof(name), "%s erase+insert", label);
+  s21_bench::report(name, n, ns, n);
+}
+
+int main(int argc, char** argv) {
+  size_type n = s21_bench::max_size_arg(argc, argv, 1000000);
+  bench_workloads<s21_hash>("s21::unordered_map", n);
+  bench_workloads<std_hash>("std::unordered_map", n);
+  bench_workloads<s21_map>("s21::map", n);
+  return 0;
+}
@@ -0,0 +1,112 @@
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+static int make(size_type i, int*) { return static_cast<int>(i); }
+static std::string make(size_type i, std::string*) {
+  return std::string(32, static_cast<char>('a' + i % 26));
+}
+
+template <typename Vector>
+static Vector filled(size_type n) {
+  using value_type = typename Vector::value_type;
+  Vector v;
+  v.reserve(n + n / 2);
+  for (size_type i = 0; i < n; i++)
+    v.push_back(make(i, static_cast<value_type*>(nullptr)));
+  return v;
+}
+
+// ops вставок в середину вектора из n элементов
+template <typename Vector>
+static void bench_middle_insert(const char* label, size_type n,
+                                size_type ops) {
+  using value_type = typename Vector::value_type;
+  Vector v = filled<Vector>(n);
+  value_type value = make(7, static_cast<value_type*>(nullptr));
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < ops; i++)
+      v.insert(v.begin() + v.size() / 2, value);
+  });
+  s21_bench::do_not_optimize(v.data());
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s middle insert", label);
+  s21_bench::report(name, n, ns, ops);
+}
+
+// ops удалений из середины по одному элементу
+template <typename Vector>
+static void bench_middle_erase(const char* label, size_type n,
+                               size_type ops) {
+  Vector v = filled<Vector>(n);
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type i = 0; i < ops; i++) v.erase(v.begin() + v.size() / 2);
+  });
+  s21_bench::do_not_optimize(v.data());
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s middle erase", label);
+  s21_bench::report(name, n, ns, ops);
+}
+
+// половина вектора удаляется диапазонами по batch элементов
+template <typename Vector>
+static void bench_batch_erase(const char* label, size_type n,
+                              size_type batch) {
+  Vector v = filled<Vector>(n);
+  size_type erased = 0;
+  double ns = s21_bench::measure_ns([&] {
+    for (; erased < n / 2; erased += batch) {
+      auto first = v.begin() + v.size() / 4;
+      v.erase(first, first + batch);
+    }
+  });
+  s21_bench::do_not_optimize(v.data());
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s batch erase(%zu)", label, batch);
+  s21_bench::report(name, n, ns, erased);
+}
+
+// вставка диапазона из batch элементов в середину
+template <typename Vector>
+static void bench_range_insert(const char* label, size_type n,
+                               size_type batch) {
+  Vector v = filled<Vector>(n);
+  Vector src = filled<Vector>(batch);
+  size_type inserted = 0;
+  double ns = s21_bench::measure_ns([&] {
+    for (; inserted < n / 2; inserted += batch)
+      v.insert(v.begin() + v.size() / 2, src.begin(), src.end());
+  });
+  s21_bench::do_not_optimize(v.data());
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s range insert(%zu)", label, batch);
+  s21_bench::report(name, n, ns, inserted);
+}
+
+template <typename S21, typename Std>
+static void run(const char* s21_label, const char* std_label, size_type n) {
+  const size_type ops = n >= 1000000 ? 200 : 2000;
+  bench_middle_insert<S21>(s21_label, n, ops);
+  bench_middle_insert<Std>(std_label, n, ops);
+  bench_middle_erase<S21>(s21_label, n, ops);
+  bench_middle_erase<Std>(std_label, n, ops);
+  bench_batch_erase<S21>(s21_label, n, 1000);
+  bench_batch_erase<Std>(std_label, n, 1000);
+  bench_range_insert<S21>(s21_label, n, 1000);
+  bench_range_insert<Std>(std_label, n, 1000);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n = 10000; n <= max_n; n *= 10) {
+    run<s21::vector<int>, std::vector<int>>("s21::vector<int>",
+                                            "std::vector<int>", n);
+    run<s21::vector<std::string>, std::vector<std::string>>(
+        "s21::vector<string>", "std::vector<string>", n);
+  }
+  return 0;
+}
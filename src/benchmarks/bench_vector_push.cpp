@@ -0,0 +1,53 @@
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+using s21_bench::size_type;
+
+// тривиально копируемый элемент в 256 байт: рост переносит его memcpy
+struct Pod256 {
+  unsigned char bytes[256];
+};
+
+static int make(size_type i, int*) { return static_cast<int>(i); }
+static std::string make(size_type i, std::string*) {
+  return std::string(32, static_cast<char>('a' + i % 26));  // больше SSO
+}
+static Pod256 make(size_type i, Pod256*) {
+  Pod256 pod;
+  pod.bytes[0] = static_cast<unsigned char>(i);
+  return pod;
+}
+
+// n вставок в конец пустого вектора, включая все расширения
+template <typename Vector>
+static void bench_push_back(const char* label, size_type n) {
+  using value_type = typename Vector::value_type;
+  const size_type rounds = n >= 1000000 ? 3 : 10000000 / n;
+  double ns = s21_bench::measure_ns([&] {
+    for (size_type r = 0; r < rounds; r++) {
+      Vector v;
+      for (size_type i = 0; i < n; i++)
+        v.push_back(make(i, static_cast<value_type*>(nullptr)));
+      s21_bench::do_not_optimize(v.data());
+    }
+  });
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s push_back", label);
+  s21_bench::report(name, n, ns, n * rounds);
+}
+
+int main(int argc, char** argv) {
+  size_type max_n = s21_bench::max_size_arg(argc, argv, 1000000);
+  for (size_type n = 1000; n <= max_n; n *= 10) {
+    bench_push_back<s21::vector<int>>("s21::vector<int>", n);
+    bench_push_back<std::vector<int>>("std::vector<int>", n);
+    bench_push_back<s21::vector<std::string>>("s21::vector<string>", n);
+    bench_push_back<std::vector<std::string>>("std::vector<string>", n);
+    bench_push_back<s21::vector<Pod256>>("s21::vector<Pod256>", n);
+    bench_push_back<std::vector<Pod256>>("std::vector<Pod256>", n);
+  }
+  return 0;
+}
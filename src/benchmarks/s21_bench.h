@@ -0,0 +1,142 @@
+#ifndef CPP_S21_CONTAINERS_BENCH_H
+#define CPP_S21_CONTAINERS_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace s21_bench {
+
+using size_type = size_t;
+
+// не дает компилятору выкинуть вычисления, результат которых не используется
+template <typename T>
+inline void do_not_optimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// время выполнения f() в наносекундах
+template <typename F>
+double measure_ns(F&& f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto finish = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(finish - start).count();
+}
+
+// лучшее из runs измерений: первый прогон часто платит за прогрев кучи
+template <typename F>
+double measure_best_ns(int runs, F&& f) {
+  double best = measure_ns(f);
+  for (int i = 1; i < runs; i++) best = std::min(best, measure_ns(f));
+  return best;
+}
+
+inline void report(const char* name, size_type n, double total_ns,
+                   size_type ops) {
+  std::printf("%-40s n=%-10zu %12.2f ns/op\n", name, n,
+              ops ? total_ns / ops : 0.0);
+}
+
+// верхняя граница размеров, можно уменьшить первым аргументом командной строки
+inline size_type max_size_arg(int argc, char** argv, size_type fallback) {
+  if (argc > 1) return std::strtoull(argv[1], nullptr, 10);
+  return fallback;
+}
+
+// текущий resident set процесса в килобайтах, 0 - если узнать нельзя
+inline size_type rss_kb() {
+#ifdef __linux__
+  size_type pages = 0, resident = 0;
+  if (std::FILE* f = std::fopen("/proc/self/statm", "r")) {
+    if (std::fscanf(f, "%zu %zu", &pages, &resident) != 2) resident = 0;
+    std::fclose(f);
+  }
+  return resident * static_cast<size_type>(sysconf(_SC_PAGESIZE)) / 1024;
+#else
+  return 0;
+#endif
+}
+
+inline std::mt19937_64& rng() {
+  static std::mt19937_64 engine(42);
+  return engine;
+}
+
+inline long long now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// привязка текущего потока к ядру cpu (по модулю числа ядер), где это можно
+inline void pin_thread(unsigned cpu) {
+#ifdef __linux__
+  unsigned cores = std::thread::hardware_concurrency();
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cores ? cpu % cores : 0, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)cpu;
+#endif
+}
+
+// пауза в цикле ожидания: на машине с одним ядром без yield второй поток
+// не получит процессор до конца кванта
+inline void spin_pause() { std::this_thread::yield(); }
+
+// p-й процентиль (0..100) выборки, выборка сортируется
+inline long long percentile(std::vector<long long>& samples, double p) {
+  if (samples.empty()) return 0;
+  std::sort(samples.begin(), samples.end());
+  size_type index = static_cast<size_type>(p / 100.0 * (samples.size() - 1));
+  return samples[index];
+}
+
+// промахи кэша за время f() по аппаратному счетчику perf, -1 - если
+// счетчик недоступен (нет прав, виртуальная машина, не Linux)
+template <typename F>
+long long count_cache_misses(F&& f) {
+#ifdef __linux__
+  perf_event_attr attr{};
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = PERF_COUNT_HW_CACHE_MISSES;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+  if (fd < 0) {
+    f();
+    return -1;
+  }
+  ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+  ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+  f();
+  ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+  long long misses = -1;
+  if (read(fd, &misses, sizeof(misses)) != sizeof(misses)) misses = -1;
+  close(fd);
+  return misses;
+#else
+  f();
+  return -1;
+#endif
+}
+
+}  // namespace s21_bench
+
+#endif
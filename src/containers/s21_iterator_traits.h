@@ -0,0 +1,26 @@
+#ifndef CPP_S21_CONTAINERS_ITERATOR_TRAITS_H
+#define CPP_S21_CONTAINERS_ITERATOR_TRAITS_H
+
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// It похож на итератор по элементам Value: разыменовывается, сдвигается ++
+// и сам не приводится к Value. Нужен, чтобы перегрузка insert_many(first,
+// last) не перехватывала вызовы вида insert_many(1, 2).
+template <typename It, typename Value, typename = void>
+struct is_iterator_of : std::false_type {};
+
+template <typename It, typename Value>
+struct is_iterator_of<It, Value,
+                      std::void_t<decltype(*std::declval<It&>()),
+                                  decltype(++std::declval<It&>())>>
+    : std::bool_constant<!std::is_convertible_v<It, Value>> {};
+
+template <typename It, typename Value>
+inline constexpr bool is_iterator_of_v = is_iterator_of<It, Value>::value;
+
+}  // namespace s21
+
+#endif
@@ -1,12 +1,24 @@
 #ifndef CPP_S21_CONTAINERS_LIST_H
 #define CPP_S21_CONTAINERS_LIST_H
 
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "s21_iterator_traits.h"
+#include "s21_node_pool.h"
 
 namespace s21 {
 
-template <typename T>
+// Двусвязный список в кольце вокруг узла-ограничителя end_: end_.next_ -
+// первый узел, end_.prev_ - последний, у пустого списка оба указывают на
+// сам end_. Поэтому end() - обычный итератор, --end() дает последний
+// элемент, а вставка и удаление по итератору - O(1) без проверок краев.
+// Alloc - политика выделения узлов (node_allocator, pool_allocator или
+// shared_pool_allocator); ее объект можно передать конструктору.
+template <typename T, typename Alloc = node_allocator>
 class list {
  public:
   using value_type = T;
@@ -15,20 +27,28 @@ class list {
   using size_type = size_t;
 
  private:
-  struct Node_ {
+  // связи узла; ограничитель end_ - только связи, без данных
+  struct NodeBase_ {
+    NodeBase_* next_;
+    NodeBase_* prev_;
+  };
+  struct Node_ : NodeBase_ {
     value_type data_;
-    Node_* next_;
-    Node_* prev_;
-    Node_(value_type value) : data_(value), next_(nullptr), prev_(nullptr) {}
+    // данные конструируются прямо в узле из аргументов конструктора T
+    template <typename... Args>
+    explicit Node_(Args&&... args)
+        : NodeBase_{nullptr, nullptr}, data_(std::forward<Args>(args)...) {}
   };
-  Node_* head_;
-  Node_* tail_;
+  NodeBase_ end_;
   size_type size_;
+  typename Alloc::template handle<Node_> nodes_;
+
+  static Node_* as_node(NodeBase_* base) { return static_cast<Node_*>(base); }
 
   class ListIterator {
    public:
     friend class list;
-    ListIterator(Node_* ptr = nullptr) : node_ptr_(ptr) {}
+    ListIterator(NodeBase_* ptr = nullptr) : node_ptr_(ptr) {}
     ListIterator& operator--() {  // префиксный
       if (node_ptr_ != nullptr) {
         node_ptr_ = node_ptr_->prev_;
@@ -45,8 +65,6 @@ class list {
         node_ptr_ = node_ptr_->next_;
       }
       return *this;
-      // node_ptr_ = node_ptr_->next_;
-      // return *this;
     }
     ListIterator operator++(int) {
       ListIterator temp{*this};
@@ -65,53 +83,52 @@ class list {
     bool operator!=(const ListIterator& other) const {
       return node_ptr_ != other.node_ptr_;
     }
-    reference operator*() const { return node_ptr_->data_; }
+    reference operator*() const { return as_node(node_ptr_)->data_; }
 
    protected:
-    Node_* node_ptr_;
+    NodeBase_* node_ptr_;
   };
 
   class ConstListIterator : public ListIterator {
    public:
-    ConstListIterator(Node_* node) : ListIterator(node) {}
+    ConstListIterator(NodeBase_* node) : ListIterator(node) {}
+    ConstListIterator(const ListIterator& it) : ListIterator(it) {}
   };
 
  public:
   using iterator = ListIterator;
   using const_iterator = ConstListIterator;
 
-  list() : head_(nullptr), tail_(nullptr), size_(0) {}
-  list(size_type n) : head_(nullptr), tail_(nullptr), size_(0) {
+  list() : end_{&end_, &end_}, size_(0) {}
+  explicit list(const Alloc& alloc)
+      : end_{&end_, &end_}, size_(0), nodes_(alloc) {}
+  list(size_type n) : list() {
     for (size_type i = 0; i < n; i++) {
       this->push_back(T());
     }
   }
-  list(std::initializer_list<value_type> const& items)
-      : head_(nullptr), tail_(nullptr), size_(0) {
-    for (value_type el : items) {
+  list(std::initializer_list<value_type> const& items) : list() {
+    for (const_reference el : items) {
       push_back(el);
     }
   }
-  list(const list& l) : head_(nullptr), tail_(nullptr), size_(0) {
+  list(const list& l) : list(l.get_allocator()) {
     for (const_iterator el = l.begin(); el != l.end(); el++) {
       this->push_back(*el);
     }
   }
-  list(list&& l) : list(l) { l.clear(); }
+  list(list&& l) noexcept : list() { this->swap(l); }
 
   ~list() { this->clear(); }
-  list& operator=(list&& l) {
+  list& operator=(list&& l) noexcept {
     if (this != &l) {
       this->clear();
-      for (iterator i = l.begin(); i != l.end(); i++) {
-        this->push_back(*i);
-      }
-      l.clear();
+      this->swap(l);
     }
     return *this;
   }
 
-  list& operator=(list& l) {
+  list& operator=(const list& l) {
     if (this != &l) {
       this->clear();
       for (iterator i = l.begin(); i != l.end(); i++) {
@@ -121,283 +138,416 @@ class list {
     return *this;
   }
 
-  const_reference front() { return this->head_->data_; }
-  const_reference back() { return this->tail_->data_; }
-
-  iterator begin() { return iterator(this->head_); }
-  iterator end() { return iterator(nullptr); }
-  const_iterator begin() const { return const_iterator(this->head_); }
-  const_iterator end() const { return const_iterator(nullptr); }
-  const_iterator cbegin() const { return const_iterator(this->head_); }
-  const_iterator cend() const { return const_iterator(nullptr); }
-  bool empty() { return this->size_ == 0; }
-  size_type size() { return this->size_; }
+  const_reference front() const { return as_node(end_.next_)->data_; }
+  const_reference back() const { return as_node(end_.prev_)->data_; }
+
+  iterator begin() { return iterator(end_.next_); }
+  iterator end() { return iterator(&end_); }
+  const_iterator begin() const { return const_iterator(end_.next_); }
+  const_iterator end() const { return const_iterator(sentinel()); }
+  const_iterator cbegin() const { return const_iterator(end_.next_); }
+  const_iterator cend() const { return const_iterator(sentinel()); }
+  bool empty() const { return this->size_ == 0; }
+  size_type size() const { return this->size_; }
   size_type max_size() {
     return std::numeric_limits<size_type>::max() / sizeof(Node_) / 2;
   }
+  Alloc get_allocator() const { return nodes_.get_allocator(); }
 
   void clear() {
-    Node_* current_node = this->head_;
-    while (current_node != nullptr) {
-      Node_* next_node = current_node->next_;
-      delete current_node;
-      current_node = next_node;
+    // пул с тривиальными узлами освобождается целиком, без обхода списка
+    if constexpr (decltype(nodes_)::kBulkRelease) {
+      nodes_.release_all();
+    } else {
+      NodeBase_* current_node = end_.next_;
+      while (current_node != &end_) {
+        NodeBase_* next_node = current_node->next_;
+        nodes_.destroy(as_node(current_node));
+        current_node = next_node;
+      }
     }
-    this->head_ = nullptr;
-    this->tail_ = nullptr;
+    end_.next_ = end_.prev_ = &end_;
     this->size_ = 0;
   }
   iterator insert(iterator pos, const_reference value) {
-    if (this->head_ == nullptr) {
-      this->push_back(value);
-      return this->begin();
-    }
-
-    Node_* current = this->head_;
-    for (iterator it = this->begin(); it != pos; it++) {
-      current = current->next_;
-    }
-    Node_* new_node = new Node_(value);
-    if (current == nullptr) {
-      current = head_;
-      while (current->next_) current = current->next_;
-      current->next_ = new_node;
-      new_node->prev_ = current;
-      tail_ = new_node;
-    } else {
-      if (current->prev_) {
-        current->prev_->next_ = new_node;  // указывает на element data_ 3.5
-        new_node->prev_ =
-            current->prev_;  //  ставим новой ноде значение предыдущей ноды(3)
-      } else
-        head_ = new_node;
-      current->prev_ = new_node;  // устаналвиаем новое значнеие
-      new_node->next_ = current;  // связываем со следущим элементом.
-    }
-    this->size_++;
-
-    return iterator(current->prev_);
+    return this->emplace(pos, value);
+  }
+  iterator insert(iterator pos, value_type&& value) {
+    return this->emplace(pos, std::move(value));
+  }
+  // новый узел вшивается перед pos, список не обходится
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args) {
+    Node_* new_node = nodes_.create(std::forward<Args>(args)...);
+    link_before(pos.node_ptr_, new_node);
+    return iterator(new_node);
   }
-  void erase(iterator pos) {
+  // возвращает итератор на элемент, следовавший за удаленным
+  iterator erase(iterator pos) {
     if (pos == end()) {
       throw std::out_of_range("OUT OF RANGE");
     }
-    if (pos == nullptr || this->head_ == nullptr) {
-      return;
-    }
-
-    Node_* current = this->head_;
-
-    for (iterator it = this->begin(); it != pos; it++) {
-      current = current->next_;
-    }
-
-    if (current == this->head_) {
-      this->pop_front();
-    } else if (current == this->tail_) {
-      this->pop_back();
-    } else {
-      current->prev_->next_ = current->next_;
-      current->next_->prev_ = current->prev_;
-      delete current;
-      this->size_--;
+    if (pos.node_ptr_ == nullptr) {
+      return pos;
     }
+    NodeBase_* next = pos.node_ptr_->next_;
+    nodes_.destroy(as_node(unlink(pos.node_ptr_)));
+    return iterator(next);
   }
   void pop_back() {
-    if (this->tail_ != nullptr) {
-      Node_* deleted_tail = this->tail_;
-
-      if (this->head_ == this->tail_) {
-        this->head_ = nullptr;
-        this->tail_ = nullptr;
-      } else {
-        this->tail_ = this->tail_->prev_;
-        this->tail_->next_ = nullptr;
-      }
-      delete deleted_tail;
-      this->size_--;
-    }
+    if (this->size_ != 0) nodes_.destroy(as_node(unlink(end_.prev_)));
   }
   void pop_front() {
-    if (this->head_ != nullptr) {
-      Node_* deleted_head = this->head_;
-      this->head_ = this->head_->next_;
-      if (this->head_ != nullptr) {
-        this->head_->prev_ = nullptr;
-      } else {
-        this->tail_ = nullptr;
-      }
-      delete deleted_head;
-      this->size_--;
-    }
+    if (this->size_ != 0) nodes_.destroy(as_node(unlink(end_.next_)));
   }
-  void push_front(const_reference value) {
-    if (this->head_ == nullptr) {
-      this->push_back(value);
-    } else {
-      Node_* new_node = new Node_(value);
-      new_node->next_ = this->head_;
-      this->head_->prev_ = new_node;
-      this->head_ = new_node;
-    }
-    this->size_++;
+  void push_front(const_reference value) { this->emplace_front(value); }
+  void push_front(value_type&& value) { this->emplace_front(std::move(value)); }
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    return *this->emplace(begin(), std::forward<Args>(args)...);
   }
-  void push_back(const_reference value) {
-    Node_* new_node = new Node_(value);
-
-    if (this->head_ == nullptr) {
-      this->head_ = new_node;
-      this->tail_ = new_node;
-    } else {
-      new_node->prev_ =
-          this->tail_;  // связываю новый узел с текущим хвостом ( то есть
-                        // указатель на предыдущий элемент)
-      this->tail_->next_ = new_node;  // связываю текущий хвост с новым узлом
-      this->tail_ = new_node;  // устанавливаю значение на новый хвост.
-    }
-    this->size_++;
+  void push_back(const_reference value) { this->emplace_back(value); }
+  void push_back(value_type&& value) { this->emplace_back(std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    return *this->emplace(end(), std::forward<Args>(args)...);
   }
-  void swap(list& other) {
-    std::swap(this->head_, other.head_);
-    std::swap(this->tail_, other.tail_);
+  // узлы ссылаются на ограничитель своего списка, поэтому при обмене
+  // крайние узлы перевязываются на новый end_
+  void swap(list& other) noexcept {
+    std::swap(this->end_, other.end_);
     std::swap(this->size_, other.size_);
+    this->nodes_.swap(other.nodes_);
+    this->adopt();
+    other.adopt();
   }
 
   void reverse() {
-    if (head_ != nullptr && head_->next_ != nullptr) {
-      Node_* current = head_;
-      Node_* temp = nullptr;
-
-      while (current != nullptr) {
-        temp = current->prev_;
-        current->prev_ = current->next_;
-        current->next_ = temp;
-        current = current->prev_;
-      }
-
-      if (temp != nullptr) {
-        tail_ = head_;
-        head_ = temp->prev_;
-      }
-    }
+    NodeBase_* current = &end_;
+    do {
+      std::swap(current->next_, current->prev_);
+      current = current->prev_;  // бывший next_
+    } while (current != &end_);
   }
   void unique() {
-    if (head_ != nullptr && head_->next_ != nullptr) {
-      Node_* current = head_;
-      while (current != nullptr && current->next_ != nullptr) {
-        if (current->data_ == current->next_->data_) {
-          Node_* duplicate = current->next_;
-          current->next_ = duplicate->next_;
-          if (duplicate->next_ != nullptr)
-            duplicate->next_->prev_ = current;
-          else
-            tail_ = current;
-          delete duplicate;
-        } else
-          current = current->next_;
+    NodeBase_* current = end_.next_;
+    while (current != &end_ && current->next_ != &end_) {
+      if (as_node(current)->data_ == as_node(current->next_)->data_) {
+        nodes_.destroy(as_node(unlink(current->next_)));
+      } else {
+        current = current->next_;
       }
     }
   }
 
+  // splice и merge только перевязывают узлы other: ни выделений памяти,
+  // ни копирования элементов, итераторы на перенесенные узлы остаются
+  // валидными. Исключение - узлы из чужого пула (pool_allocator): их
+  // элементы переносятся перемещением в новые узлы
   void splice(const_iterator pos, list& other) {
-    if (other.size() != 0) {
-      for (auto item : other) {
-        insert(pos, item);
+    if (this == &other || other.size_ == 0) return;
+    steal(pos.node_ptr_, other, other.end_.next_, &other.end_, other.size_);
+  }
+  void splice(const_iterator pos, list& other, const_iterator it) {
+    NodeBase_* node = it.node_ptr_;
+    if (node == pos.node_ptr_ || node->next_ == pos.node_ptr_) return;
+    steal(pos.node_ptr_, other, node, node->next_, 1);
+  }
+  // для чужого списка длина [first, last) считается проходом по диапазону
+  void splice(const_iterator pos, list& other, const_iterator first,
+              const_iterator last) {
+    if (first == last) return;
+    size_type count = 0;
+    if (this != &other) {
+      for (NodeBase_* node = first.node_ptr_; node != last.node_ptr_;
+           node = node->next_) {
+        count++;
       }
     }
+    steal(pos.node_ptr_, other, first.node_ptr_, last.node_ptr_, count);
   }
+  // устойчивое слияние: при равенстве элементы this идут первыми. Узлы
+  // other сначала пристыковываются в конец, затем подряд идущие меньшие
+  // элементы переставляются на место одной перевязкой на серию
   void merge(list& other) {
-    if (other.size() != 0) {
-      iterator pos1 = begin();
-      iterator pos2 = other.begin();
-      while (pos2 != other.end()) {
-        if (pos1 == end() || *pos1 >= *pos2) {
-          insert(pos1, *pos2);
-          ++pos2;
-        } else
-          ++pos1;
+    if (this == &other || other.size_ == 0) return;
+    NodeBase_* last = end_.prev_;
+    this->splice(end(), other);
+    NodeBase_* pos = end_.next_;
+    NodeBase_* run = last->next_;
+    while (pos != run && run != &end_) {
+      if (as_node(run)->data_ < as_node(pos)->data_) {
+        NodeBase_* run_end = run->next_;
+        while (run_end != &end_ &&
+               as_node(run_end)->data_ < as_node(pos)->data_) {
+          run_end = run_end->next_;
+        }
+        transfer(pos, run, run_end);
+        run = run_end;
+      } else {
+        pos = pos->next_;
       }
-      other.clear();
     }
   }
 
-  Node_* split(Node_* head_) {
-    Node_* slow = head_;
-    Node_* fast = head_;
-
-    while (fast->next_ != nullptr && fast->next_->next_ != nullptr) {
-      slow = slow->next_;
-      fast = fast->next_->next_;
+  // естественная сортировка слиянием снизу вверх, без рекурсии: цепочка
+  // режется на уже упорядоченные серии (строго убывающие разворачиваются),
+  // серии сливаются как разряды двоичного счетчика в runs[]. Устойчива,
+  // O(n log n) в худшем случае и O(n) на упорядоченных данных. Если comp
+  // бросает исключение, все узлы снова сшиваются в список (порядок
+  // элементов при этом не определен) и исключение уходит дальше
+  void sort() { this->sort(std::less<value_type>()); }
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (this->size_ < 2) return;
+    end_.prev_->next_ = nullptr;
+    NodeBase_* runs[kMaxRuns] = {};
+    NodeBase_ *rest = end_.next_, *carry = nullptr, *head = nullptr;
+    try {
+      while (rest != nullptr) {
+        carry = take_run(rest, comp);
+        size_type level = 0;
+        // более ранняя серия идет первым аргументом merge ради устойчивости
+        for (; runs[level] != nullptr; level++) {
+          carry = merge(runs[level], carry, comp);
+          runs[level] = nullptr;
+        }
+        runs[level] = carry;
+        carry = nullptr;
+      }
+      for (NodeBase_*& run : runs) {
+        if (run == nullptr) continue;
+        head = head ? merge(run, head, comp) : run;
+        run = nullptr;
+      }
+    } catch (...) {
+      // помощники оставляют каждый узел ровно в одной из этих цепочек
+      for (NodeBase_* run : runs) head = concat(run, head);
+      relink_chain(concat(concat(carry, head), rest));
+      throw;
     }
-
-    Node_* second_half = slow->next_;
-    slow->next_ = nullptr;
-    if (second_half != nullptr) second_half->prev_ = nullptr;
-
-    return second_half;
+    relink_chain(head);
   }
 
-  Node_* merge(Node_* first, Node_* second) {
-    if (!first) return second;
-    if (!second) return first;
-
-    if (first->data_ < second->data_) {
-      first->next_ = merge(first->next_, second);
-      if (first->next_) first->next_->prev_ = first;
+  // новые узлы сначала связываются в цепочку, а затем вшиваются перед pos
+  // за одну перевязку; возвращается итератор на последний вставленный
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args) {
+    Chain chain;
+    try {
+      (chain.append(nodes_.create(std::forward<Args>(args))), ...);
+    } catch (...) {
+      chain.destroy(nodes_);
+      throw;
+    }
+    return this->link_chain(pos, chain);
+  }
+  template <typename InputIt,
+            typename = std::enable_if_t<is_iterator_of_v<InputIt, T>>>
+  iterator insert_many(const_iterator pos, InputIt first, InputIt last) {
+    Chain chain;
+    try {
+      for (; first != last; ++first) chain.append(nodes_.create(*first));
+    } catch (...) {
+      chain.destroy(nodes_);
+      throw;
+    }
+    return this->link_chain(pos, chain);
+  }
+  template <typename... Args>
+  void insert_many_back(Args&&... args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+  template <typename... Args>
+  void insert_many_front(Args&&... args) {
+    (emplace_front(std::forward<Args>(args)), ...);
+  }
 
-      first->prev_ = nullptr;
-      return first;
+ private:
+  NodeBase_* sentinel() const { return const_cast<NodeBase_*>(&end_); }
+
+  // вшивает node перед before
+  void link_before(NodeBase_* before, NodeBase_* node) {
+    node->next_ = before;
+    node->prev_ = before->prev_;
+    before->prev_->next_ = node;
+    before->prev_ = node;
+    this->size_++;
+  }
+  // выпутывает node из кольца и возвращает его
+  NodeBase_* unlink(NodeBase_* node) {
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+    this->size_--;
+    return node;
+  }
+  // после копирования ограничителя крайние узлы смотрят на чужой end_
+  void adopt() {
+    if (this->size_ == 0) {
+      end_.next_ = end_.prev_ = &end_;
     } else {
-      second->next_ = merge(first, second->next_);
-      if (second->next_) second->next_->prev_ = second;
-
-      second->prev_ = nullptr;
-      return second;
+      end_.next_->prev_ = &end_;
+      end_.prev_->next_ = &end_;
     }
   }
 
-  Node_* mergeSort(Node_* head_) {
-    if (!head_ || !head_->next_) return head_;
-    Node_* second = split(head_);
-    head_ = mergeSort(head_);
-    second = mergeSort(second);
-    return merge(head_, second);
+  // переносит count узлов [first, last) из other перед pos
+  void steal(NodeBase_* pos, list& other, NodeBase_* first, NodeBase_* last,
+             size_type count) {
+    if (this->nodes_.shares_with(other.nodes_)) {
+      transfer(pos, first, last);
+      other.size_ -= count;
+      this->size_ += count;
+      return;
+    }
+    while (first != last) {
+      NodeBase_* next = first->next_;
+      this->emplace(iterator(pos), std::move(as_node(first)->data_));
+      other.nodes_.destroy(as_node(other.unlink(first)));
+      first = next;
+    }
+  }
+  // переносит узлы [first, last) перед pos; размеры списков не меняет
+  static void transfer(NodeBase_* pos, NodeBase_* first, NodeBase_* last) {
+    if (first == last || pos == last) return;
+    NodeBase_* tail = last->prev_;
+    first->prev_->next_ = last;
+    last->prev_ = first->prev_;
+    tail->next_ = pos;
+    first->prev_ = pos->prev_;
+    pos->prev_->next_ = first;
+    pos->prev_ = tail;
   }
 
-  void sort() {
-    if (head_ != nullptr && head_->next_ != nullptr) {
-      head_ = mergeSort(head_);
-      tail_ = head_;
-      while (tail_->next_ != nullptr) {
-        tail_ = tail_->next_;
+  // серий не больше size_, а разряд k счетчика держит 2^k серий
+  static constexpr size_type kMaxRuns = sizeof(size_type) * 8;
+
+  // отрезает от начала цепочки rest упорядоченную серию и возвращает ее;
+  // строго убывающая серия разворачивается, равные элементы не переставляются.
+  // При исключении из comp все узлы остаются одной цепочкой в rest
+  template <typename Compare>
+  static NodeBase_* take_run(NodeBase_*& rest, Compare& comp) {
+    NodeBase_* head = rest;
+    NodeBase_* tail = head;
+    NodeBase_* next = head->next_;
+    if (next != nullptr && comp(as_node(next)->data_, as_node(head)->data_)) {
+      // убывающая серия собирается задом наперед
+      tail->next_ = nullptr;
+      try {
+        while (next != nullptr &&
+               comp(as_node(next)->data_, as_node(head)->data_)) {
+          NodeBase_* after = next->next_;
+          next->next_ = head;
+          head = next;
+          next = after;
+        }
+      } catch (...) {
+        tail->next_ = next;  // развернутая часть, за ней необработанная
+        rest = head;
+        throw;
       }
+    } else {
+      while (next != nullptr &&
+             !comp(as_node(next)->data_, as_node(tail)->data_)) {
+        tail = next;
+        next = next->next_;
+      }
+      tail->next_ = nullptr;
     }
+    rest = next;
+    return head;
   }
 
-  template <typename... Args>
-  iterator insert_many(const_iterator pos, Args&&... args) {
-    std::initializer_list<value_type> arguments{args...};
-    iterator current_pos = nullptr;
-    for (auto elem : arguments) {
-      current_pos = insert(pos, elem);
-    }
-    return current_pos;
+  // слияние двух упорядоченных цепочек; при равенстве первым идет узел
+  // first. При исключении из comp все узлы остаются одной цепочкой в first,
+  // а second обнуляется
+  template <typename Compare>
+  static NodeBase_* merge(NodeBase_*& first, NodeBase_*& second,
+                          Compare& comp) {
+    NodeBase_ head{nullptr, nullptr};
+    NodeBase_* tail = &head;
+    NodeBase_ *left = first, *right = second;
+    try {
+      while (left && right) {
+        if (comp(as_node(right)->data_, as_node(left)->data_)) {
+          tail->next_ = right;
+          right = right->next_;
+        } else {
+          tail->next_ = left;
+          left = left->next_;
+        }
+        tail = tail->next_;
+      }
+    } catch (...) {
+      tail->next_ = concat(left, right);
+      first = head.next_;
+      second = nullptr;
+      throw;
+    }
+    tail->next_ = left ? left : right;
+    return head.next_;
   }
-  template <typename... Args>
-  void insert_many_back(Args&&... args) {
-    std::initializer_list<value_type> arguments{args...};
-    for (auto elem : arguments) {
-      push_back(elem);
+
+  // цепочка first, за ней second; обе могут быть пустыми
+  static NodeBase_* concat(NodeBase_* first, NodeBase_* second) {
+    if (first == nullptr) return second;
+    NodeBase_* last = first;
+    while (last->next_ != nullptr) last = last->next_;
+    last->next_ = second;
+    return first;
+  }
+
+  // сшивает цепочку по next_ в кольцо вокруг end_, восстанавливая prev_
+  void relink_chain(NodeBase_* head) {
+    NodeBase_* prev = &end_;
+    for (NodeBase_* node = head; node != nullptr; node = node->next_) {
+      prev->next_ = node;
+      node->prev_ = prev;
+      prev = node;
     }
+    prev->next_ = &end_;
+    end_.prev_ = prev;
   }
-  template <typename... Args>
-  void insert_many_front(Args&&... args) {
-    std::initializer_list<value_type> arguments{args...};
-    for (auto elem : arguments) {
-      push_front(elem);
+
+  // несвязанная с контейнером цепочка узлов
+  struct Chain {
+    NodeBase_* first = nullptr;
+    NodeBase_* last = nullptr;
+    size_type size = 0;
+
+    void append(NodeBase_* node) {
+      node->prev_ = last;
+      if (last) {
+        last->next_ = node;
+      } else {
+        first = node;
+      }
+      last = node;
+      size++;
+    }
+    template <typename Nodes>
+    void destroy(Nodes& nodes) {
+      while (size != 0) {
+        NodeBase_* next = first->next_;
+        nodes.destroy(as_node(first));
+        first = next;
+        size--;
+      }
     }
+  };
+
+  // вшивает цепочку перед pos
+  iterator link_chain(iterator pos, Chain& chain) {
+    if (chain.size == 0) return pos;
+    NodeBase_* before = pos.node_ptr_;
+    chain.first->prev_ = before->prev_;
+    chain.last->next_ = before;
+    before->prev_->next_ = chain.first;
+    before->prev_ = chain.last;
+    this->size_ += chain.size;
+    return iterator(chain.last);
   }
 };
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
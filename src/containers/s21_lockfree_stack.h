@@ -0,0 +1,174 @@
+#ifndef CPP_S21_CONTAINERS_LOCKFREE_STACK_H
+#define CPP_S21_CONTAINERS_LOCKFREE_STACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Стек Трайбера для многих потоков. Вершина - одно 64-битное слово:
+// индекс узла и 32-битный тег, который растет при каждом изменении, так
+// что CAS со старым значением вершины не пройдет, даже если узел успели
+// снять и вернуть обратно (проблема ABA).
+// Узлы не отдаются системе до разрушения стека: снятые узлы уходят во
+// второй такой же стек свободных узлов и переиспользуются, поэтому поток,
+// прочитавший вершину до чужого pop, читает живую память. Блоки узлов
+// удваиваются и адресуются по индексу, сами блоки не перемещаются.
+template <typename T>
+class lockfree_stack {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  lockfree_stack() noexcept
+      : top_(kNull), free_(kNull), size_(0), blocks_used_(0) {
+    for (auto& block : blocks_) block.store(nullptr);
+  }
+  lockfree_stack(const lockfree_stack&) = delete;
+  lockfree_stack& operator=(const lockfree_stack&) = delete;
+  ~lockfree_stack() {
+    for (uint32_t index = unpack_index(top_.load()); index != kNull;) {
+      Node& node = node_at(index);
+      node.value()->~value_type();
+      index = node.next.load(std::memory_order_relaxed);
+    }
+    for (size_type k = 0; k < kMaxBlocks; k++) {
+      Node* block = blocks_[k].load();
+      if (block == nullptr) continue;
+      for (size_type i = 0; i < block_nodes(k); i++) block[i].~Node();
+      ::operator delete(block);
+    }
+  }
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type&& value) { emplace(std::move(value)); }
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    uint32_t index = acquire_node();
+    Node& node = node_at(index);
+    try {
+      new (node.value()) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      push_index(free_, index);
+      throw;
+    }
+    push_index(top_, index);
+    size_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // false, если стек пуст
+  bool try_pop(reference out) {
+    uint32_t index = pop_index(top_);
+    if (index == kNull) return false;
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    value_type* value = node_at(index).value();
+    out = std::move(*value);
+    value->~value_type();
+    push_index(free_, index);
+    return true;
+  }
+
+  bool empty() const { return unpack_index(top_.load()) == kNull; }
+  // из других потоков результат приблизительный
+  size_type size() const {
+    long long size = size_.load(std::memory_order_relaxed);
+    return size > 0 ? static_cast<size_type>(size) : 0;
+  }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+  static constexpr uint32_t kNull = 0xFFFFFFFF;
+  // блок k держит kFirstBlock << k узлов; 26 блоков - почти 2^32 индексов
+  static constexpr size_type kFirstBlock = 64;
+  static constexpr size_type kMaxBlocks = 26;
+
+  struct Node {
+    // читается потоками, которые опоздали со снятием этого узла
+    std::atomic<uint32_t> next;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+    value_type* value() { return reinterpret_cast<value_type*>(storage); }
+  };
+
+  static uint32_t unpack_index(uint64_t word) {
+    return static_cast<uint32_t>(word);
+  }
+  static uint64_t pack(uint64_t old_word, uint32_t index) {
+    return ((old_word >> 32) + 1) << 32 | index;
+  }
+  static size_type block_nodes(size_type k) { return kFirstBlock << k; }
+  // индекс первого узла блока k
+  static size_type block_start(size_type k) {
+    return kFirstBlock * ((size_type{1} << k) - 1);
+  }
+
+  Node& node_at(uint32_t index) const {
+    size_type q = index / kFirstBlock + 1;
+    size_type k = 0;
+    while (q >>= 1) k++;
+    Node* block = blocks_[k].load(std::memory_order_acquire);
+    return block[index - block_start(k)];
+  }
+
+  void push_index(std::atomic<uint64_t>& head, uint32_t index) {
+    push_chain(head, index, index);
+  }
+  // кладет на head цепочку first..last, уже связанную через next
+  void push_chain(std::atomic<uint64_t>& head, uint32_t first,
+                  uint32_t last) {
+    Node& tail = node_at(last);
+    uint64_t old_word = head.load(std::memory_order_relaxed);
+    do {
+      tail.next.store(unpack_index(old_word), std::memory_order_relaxed);
+    } while (!head.compare_exchange_weak(old_word, pack(old_word, first),
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+  }
+  uint32_t pop_index(std::atomic<uint64_t>& head) {
+    uint64_t old_word = head.load(std::memory_order_acquire);
+    for (;;) {
+      uint32_t index = unpack_index(old_word);
+      if (index == kNull) return kNull;
+      uint32_t next = node_at(index).next.load(std::memory_order_relaxed);
+      if (head.compare_exchange_weak(old_word, pack(old_word, next),
+                                     std::memory_order_acquire,
+                                     std::memory_order_acquire)) {
+        return index;
+      }
+    }
+  }
+
+  // свободный узел; если их нет - новый блок, остаток которого сразу
+  // уходит в стек свободных
+  uint32_t acquire_node() {
+    uint32_t index = pop_index(free_);
+    if (index != kNull) return index;
+
+    size_type k = blocks_used_.fetch_add(1);
+    if (k >= kMaxBlocks) throw std::bad_alloc();
+    size_type count = block_nodes(k);
+    Node* block = static_cast<Node*>(::operator new(count * sizeof(Node)));
+    uint32_t first = static_cast<uint32_t>(block_start(k));
+    for (size_type i = 0; i < count; i++) {
+      new (&block[i]) Node;
+      block[i].next.store(first + static_cast<uint32_t>(i) + 1,
+                          std::memory_order_relaxed);
+    }
+    blocks_[k].store(block, std::memory_order_release);
+    push_chain(free_, first + 1, first + static_cast<uint32_t>(count) - 1);
+    return first;
+  }
+
+  alignas(kCacheLine) std::atomic<uint64_t> top_;
+  alignas(kCacheLine) std::atomic<uint64_t> free_;
+  alignas(kCacheLine) std::atomic<long long> size_;
+  std::atomic<size_type> blocks_used_;
+  std::atomic<Node*> blocks_[kMaxBlocks];
+};
+
+}  // namespace s21
+
+#endif
@@ -4,61 +4,78 @@
 #include "s21_rbtree.h"
 #include "s21_vector.h"
 namespace s21 {
-template <typename Key, typename T>
-class map : public s21::rbtree<Key, T> {
+template <typename Key, typename T, typename Alloc = node_allocator,
+          bool Ranked = false>
+class map : public s21::rbtree<Key, T, Alloc, Ranked> {
+  using tree_type = s21::rbtree<Key, T, Alloc, Ranked>;
   using key_type = Key;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename rbtree<Key, T>::TreeIterator;
-  using const_iterator = typename rbtree<Key, T>::ConstTreeIterator;
+  using iterator = typename tree_type::TreeIterator;
+  using const_iterator = typename tree_type::ConstTreeIterator;
   using size_type = size_t;
 
  public:
-  map() : rbtree<Key, T>(){};
+  map() : tree_type(){};
+  explicit map(const Alloc& alloc) : tree_type(alloc) {}
   map(std::initializer_list<value_type> const& items) {
     for (value_type el : items) {
       this->insert(el);
     }
   }
-  map(const map& m) {
-    for (auto i = m.begin(); i != m.end(); i++) {
-      this->insert(*i);
-    }
+  // копия повторяет форму дерева m за O(n)
+  map(const map& m) : tree_type(m.get_allocator()) {
+    this->copy_from(m);
   }
-  map(map&& m) : map(m) { m.clear(); }
+  map(map&& m) noexcept : tree_type(std::move(m)) {}
   ~map() = default;
-  map& operator=(map&& m) {
-    if (this != &m) {
-      this->clear();
-      for (auto i = m.begin(); i != m.end(); i++) {
-        this->insert(*i);
-      }
-      m.clear();
-    }
+  map& operator=(map&& m) noexcept {
+    tree_type::operator=(std::move(m));
     return *this;
   }
-  map& operator=(map& m) {
-    if (this != &m) {
-      this->clear();
-      for (auto i = m.begin(); i != m.end(); i++) {
-        this->insert(*i);
-      }
-    }
+  map& operator=(const map& m) {
+    if (this != &m) this->copy_from(m);
     return *this;
   }
   std::pair<iterator, bool> insert(const Key& key, const T& obj) {
     if (this->contains(key)) return {iterator(nullptr), false};
-    return rbtree<Key, T>::insert({key, obj});
+    return tree_type::insert({key, obj});
   }
 
   std::pair<iterator, bool> insert(const value_type& value) {
     return this->insert(value.first, value.second);
   }
+  // вставка как можно ближе перед hint: в конец (hint = end()) и рядом с
+  // подсказкой - без спуска от корня. Если ключ уже есть, значение не
+  // меняется и возвращается итератор на него
+  iterator insert(iterator hint, const value_type& value) {
+    return iterator(
+        tree_type::insert_hint(hint, true, value.first, value.second).first);
+  }
+  // значение перемещается в узел
+  iterator insert(iterator hint, value_type&& value) {
+    return iterator(
+        tree_type::insert_hint(hint, true, value.first, std::move(value.second))
+            .first);
+  }
+  // ключ и значение строятся из своих аргументов и перемещаются в узел
+  template <typename K, typename M>
+  iterator emplace_hint(iterator hint, K&& key, M&& obj) {
+    Key node_key(std::forward<K>(key));
+    T node_obj(std::forward<M>(obj));
+    return iterator(tree_type::insert_hint(hint, true, std::move(node_key),
+                                           std::move(node_obj))
+                        .first);
+  }
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args) {
+    return insert(hint, value_type(std::forward<Args>(args)...));
+  }
 
   std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
-    typename rbtree<Key, T>::Node* node = this->getNode({key, obj});
+    typename tree_type::Node* node = this->getNode({key, obj});
 
     if (node != nullptr) {
       iterator it = this->find(key);
@@ -73,8 +90,11 @@ class map : public s21::rbtree<Key, T> {
     return this->insert(key, obj);
   }
 
+  // ключи, которые уже есть, остаются в other вместе со значениями
+  void merge(map& other) { tree_type::merge_nodes(other, true); }
+
   T& at(const Key& key) {
-    iterator it = rbtree<Key, T>::find(key);
+    iterator it = tree_type::find(key);
     if (it == nullptr) {
       throw std::out_of_range("Out of range");
     }
@@ -82,7 +102,7 @@ class map : public s21::rbtree<Key, T> {
   }
 
   T& operator[](const Key& key) {
-    iterator it = rbtree<Key, T>::find(key);
+    iterator it = tree_type::find(key);
     if (it != nullptr) {
       return it.getValue();
     }
@@ -90,15 +110,24 @@ class map : public s21::rbtree<Key, T> {
     return result.first.getValue();
   }
 
+  // ключи сортируются один раз, новые узлы встраиваются в дерево пачкой
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
-    s21::vector<std::pair<iterator, bool>> results;
-
-    for (const auto& el : {args...}) {
-      results.push_back(insert(el.first, el.second));
-    }
-
-    return results;
+    s21::vector<std::pair<Key, T>> items;
+    items.reserve(sizeof...(Args));
+    (items.push_back(std::pair<Key, T>(std::forward<Args>(args))), ...);
+    return tree_type::template insert_bulk<iterator>(items, true);
+  }
+  template <typename InputIt,
+            typename = std::enable_if_t<is_iterator_of_v<InputIt, value_type>>>
+  s21::vector<std::pair<iterator, bool>> insert_many(InputIt first,
+                                                     InputIt last) {
+    s21::vector<std::pair<Key, T>> items;
+    size_type count = 0;
+    for (InputIt it = first; it != last; ++it) count++;
+    items.reserve(count);
+    for (; first != last; ++first) items.push_back(std::pair<Key, T>(*first));
+    return tree_type::template insert_bulk<iterator>(items, true);
   }
 };
 }  // namespace s21
@@ -0,0 +1,205 @@
+#ifndef CPP_S21_CONTAINERS_MPMC_QUEUE_H
+#define CPP_S21_CONTAINERS_MPMC_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Ограниченная очередь для многих производителей и потребителей
+// (кольцо с номерами последовательности по Вьюкову). try_push/try_pop не
+// блокируются; push/pop ждут места/элемента на условной переменной, но
+// мьютекс берется только когда кто-то действительно ждет.
+// После close() push возвращает false, pop дочитывает оставшееся и затем
+// тоже возвращает false.
+// Между захватом ячейки и публикацией ее номера ничто не должно бросать,
+// иначе соседи по кольцу ждут вечно, поэтому перемещение T - noexcept.
+template <typename T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "mpmc_queue requires a noexcept move constructor");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  // емкость округляется вверх до степени двойки
+  explicit mpmc_queue(size_type capacity = 1024)
+      : enqueue_pos_(0),
+        dequeue_pos_(0),
+        closed_(false),
+        push_waiters_(0),
+        pop_waiters_(0) {
+    capacity_ = 2;
+    while (capacity_ < capacity) capacity_ *= 2;
+    mask_ = capacity_ - 1;
+    cells_ = static_cast<Cell*>(::operator new(capacity_ * sizeof(Cell)));
+    for (size_type i = 0; i < capacity_; i++) {
+      new (&cells_[i].sequence) std::atomic<size_type>(i);
+    }
+  }
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+  ~mpmc_queue() {
+    size_type end = enqueue_pos_.load(std::memory_order_relaxed);
+    for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+         pos != end; pos++) {
+      cells_[pos & mask_].value()->~value_type();
+    }
+    for (size_type i = 0; i < capacity_; i++) {
+      cells_[i].sequence.~atomic();
+    }
+    ::operator delete(cells_);
+  }
+
+  bool try_push(const_reference value) { return emplace(value); }
+  bool try_push(value_type&& value) { return emplace(std::move(value)); }
+
+  bool try_pop(reference out) {
+    size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_type seq = cell->sequence.load(std::memory_order_acquire);
+      long long diff =
+          static_cast<long long>(seq) - static_cast<long long>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1)) break;
+      } else if (diff < 0) {
+        return false;  // пусто
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    // ячейка освобождается до присваивания в out, которое может бросить
+    value_type* el = cell->value();
+    value_type item(std::move(*el));
+    el->~value_type();
+    cell->sequence.store(pos + capacity_, std::memory_order_release);
+    wake(push_waiters_, not_full_);
+    out = std::move(item);
+    return true;
+  }
+
+  // ждет свободного места; false, если очередь закрыта
+  bool push(const_reference value) { return blocking_push(value); }
+  bool push(value_type&& value) { return blocking_push(std::move(value)); }
+
+  // ждет элемента; false, если очередь закрыта и пуста
+  bool pop(reference out) {
+    for (;;) {
+      if (try_pop(out)) return true;
+      std::unique_lock<std::mutex> lock(mutex_);
+      pop_waiters_++;
+      not_empty_.wait(lock, [this] { return closed_ || !looks_empty(); });
+      pop_waiters_--;
+      if (closed_ && looks_empty()) return false;
+    }
+  }
+
+  void close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_full_.notify_all();
+    not_empty_.notify_all();
+  }
+  bool is_closed() const { return closed_.load(); }
+
+  // из других потоков результат приблизительный
+  size_type size() const {
+    size_type dequeue = dequeue_pos_.load();
+    size_type enqueue = enqueue_pos_.load();
+    return enqueue - dequeue;
+  }
+  bool empty() const { return size() == 0; }
+  size_type capacity() const { return capacity_; }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+    value_type* value() { return reinterpret_cast<value_type*>(storage); }
+  };
+
+  // бросающее конструирование (копия) делается до захвата ячейки, в
+  // ячейку элемент только перемещается
+  template <typename U>
+  bool emplace(U&& value) {
+    if constexpr (!std::is_nothrow_constructible_v<value_type, U&&>) {
+      value_type item(std::forward<U>(value));
+      return emplace(std::move(item));
+    }
+    if (closed_.load(std::memory_order_relaxed)) return false;
+    size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_type seq = cell->sequence.load(std::memory_order_acquire);
+      long long diff =
+          static_cast<long long>(seq) - static_cast<long long>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1)) break;
+      } else if (diff < 0) {
+        return false;  // заполнено
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    new (cell->value()) value_type(std::forward<U>(value));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    wake(pop_waiters_, not_empty_);
+    return true;
+  }
+
+  template <typename U>
+  bool blocking_push(U&& value) {
+    if constexpr (!std::is_nothrow_constructible_v<value_type, U&&>) {
+      value_type item(std::forward<U>(value));  // одна копия на все попытки
+      return blocking_push(std::move(item));
+    }
+    for (;;) {
+      if (closed_) return false;
+      if (emplace(std::forward<U>(value))) return true;
+      std::unique_lock<std::mutex> lock(mutex_);
+      push_waiters_++;
+      not_full_.wait(lock, [this] { return closed_ || !looks_full(); });
+      push_waiters_--;
+    }
+  }
+
+  // счетчик ждущих увеличивается под мьютексом до проверки условия, а
+  // позиции и счетчики - seq_cst, поэтому либо ждущий увидит изменение
+  // позиции, либо разбудивший увидит ждущего
+  void wake(std::atomic<int>& waiters, std::condition_variable& cv) {
+    if (waiters.load() > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv.notify_one();
+    }
+  }
+  bool looks_full() const { return size() >= capacity_; }
+  bool looks_empty() const { return size() == 0; }
+
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_;
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_;
+  alignas(kCacheLine) Cell* cells_;
+  size_type capacity_;
+  size_type mask_;
+  std::atomic<bool> closed_;
+  std::atomic<int> push_waiters_;
+  std::atomic<int> pop_waiters_;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,276 @@
+#ifndef CPP_S21_CONTAINERS_NODE_POOL_H
+#define CPP_S21_CONTAINERS_NODE_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Пул узлов одного типа: узлы нарезаются из больших блоков (slab),
+// освобожденные узлы попадают в free list и переиспользуются.
+template <typename Node>
+class node_pool {
+ public:
+  using size_type = size_t;
+
+  node_pool() noexcept
+      : slabs_(nullptr), free_(nullptr), next_slab_nodes_(kMinSlabNodes) {}
+  node_pool(const node_pool&) = delete;
+  node_pool& operator=(const node_pool&) = delete;
+  ~node_pool() { release(); }
+
+  void* allocate() {
+    if (free_ == nullptr) grow();
+    Slot* slot = free_;
+    free_ = slot->next;
+    return slot;
+  }
+
+  void deallocate(void* ptr) noexcept {
+    Slot* slot = static_cast<Slot*>(ptr);
+    slot->next = free_;
+    free_ = slot;
+  }
+
+  // отдает все блоки разом, деструкторы узлов не вызываются
+  void release() noexcept {
+    while (slabs_ != nullptr) {
+      Slab* next = slabs_->next;
+      ::operator delete(slabs_);
+      slabs_ = next;
+    }
+    free_ = nullptr;
+    next_slab_nodes_ = kMinSlabNodes;
+  }
+
+  void swap(node_pool& other) noexcept {
+    std::swap(slabs_, other.slabs_);
+    std::swap(free_, other.free_);
+    std::swap(next_slab_nodes_, other.next_slab_nodes_);
+  }
+
+ private:
+  static constexpr size_type kMinSlabNodes = 64;
+  static constexpr size_type kMaxSlabNodes = 8192;
+
+  static_assert(alignof(Node) <= alignof(std::max_align_t),
+                "over-aligned nodes are not supported");
+
+  union Slot {
+    Slot* next;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+  struct Slab {
+    Slab* next;
+  };
+  // слоты начинаются сразу после заголовка с учетом выравнивания
+  static constexpr size_type kHeader =
+      (sizeof(Slab) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+
+  void grow() {
+    size_type count = next_slab_nodes_;
+    Slab* slab =
+        static_cast<Slab*>(::operator new(kHeader + count * sizeof(Slot)));
+    slab->next = slabs_;
+    slabs_ = slab;
+
+    Slot* slots = reinterpret_cast<Slot*>(reinterpret_cast<char*>(slab) +
+                                          kHeader);
+    for (size_type i = count; i > 0; i--) {
+      slots[i - 1].next = free_;
+      free_ = &slots[i - 1];
+    }
+    if (next_slab_nodes_ < kMaxSlabNodes) next_slab_nodes_ *= 2;
+  }
+
+  Slab* slabs_;
+  Slot* free_;
+  size_type next_slab_nodes_;
+};
+
+// Пул, общий для нескольких контейнеров: узлы можно перевязывать между
+// ними (splice, merge), а память, освобожденная одним контейнером,
+// достается другому. Внутри - по node_pool на каждый тип узла.
+// Владеет пулом пользователь: он должен пережить все контейнеры, которые
+// его используют, и при разрушении отдает системе все блоки разом.
+// Пул не синхронизирован: контейнеры с одним пулом работают в одном
+// потоке или под общей блокировкой; разным потокам - разные пулы.
+class shared_pool {
+ public:
+  shared_pool() noexcept : pools_(nullptr) {}
+  shared_pool(const shared_pool&) = delete;
+  shared_pool& operator=(const shared_pool&) = delete;
+  ~shared_pool() {
+    while (pools_ != nullptr) {
+      Entry* next = pools_->next;
+      pools_->destroy(pools_);
+      pools_ = next;
+    }
+  }
+
+  // пул узлов Node, создается при первом обращении
+  template <typename Node>
+  node_pool<Node>& get() {
+    for (Entry* entry = pools_; entry != nullptr; entry = entry->next) {
+      if (entry->tag == &kTag<Node>) {
+        return static_cast<TypedEntry<Node>*>(entry)->pool;
+      }
+    }
+    TypedEntry<Node>* entry = new TypedEntry<Node>;
+    entry->tag = &kTag<Node>;
+    entry->next = pools_;
+    entry->destroy = [](Entry* self) {
+      delete static_cast<TypedEntry<Node>*>(self);
+    };
+    pools_ = entry;
+    return entry->pool;
+  }
+
+ private:
+  struct Entry {
+    const void* tag;
+    Entry* next;
+    void (*destroy)(Entry*);
+  };
+  template <typename Node>
+  struct TypedEntry : Entry {
+    node_pool<Node> pool;
+  };
+  // адрес kTag<Node> различает типы узлов без RTTI
+  template <typename Node>
+  static constexpr char kTag = 0;
+
+  Entry* pools_;
+};
+
+// Политики выделения узлов для узловых контейнеров. Контейнер хранит
+// Alloc::handle<Node> и создает/удаляет узлы только через него; handle
+// строится из объекта политики, переданного конструктору контейнера, а
+// копия контейнера получает политику оригинала (get_allocator).
+
+// по умолчанию: каждый узел - отдельный new/delete
+struct node_allocator {
+  template <typename Node>
+  class handle {
+   public:
+    // можно ли освободить все узлы разом, не обходя их
+    static constexpr bool kBulkRelease = false;
+
+    handle() = default;
+    explicit handle(const node_allocator&) noexcept {}
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+      return new Node{std::forward<Args>(args)...};
+    }
+    void destroy(Node* node) { delete node; }
+    void release_all() noexcept {}
+    void swap(handle&) noexcept {}
+    // узлы other можно перевязать в этот контейнер и удалить через *this
+    bool shares_with(const handle&) const noexcept { return true; }
+    node_allocator get_allocator() const noexcept { return {}; }
+  };
+};
+
+// узлы берутся из собственного пула контейнера
+struct pool_allocator {
+  template <typename Node>
+  class handle {
+   public:
+    static constexpr bool kBulkRelease =
+        std::is_trivially_destructible_v<Node>;
+
+    handle() = default;
+    explicit handle(const pool_allocator&) noexcept {}
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+      void* ptr = pool_.allocate();
+      try {
+        return new (ptr) Node{std::forward<Args>(args)...};
+      } catch (...) {
+        pool_.deallocate(ptr);
+        throw;
+      }
+    }
+    void destroy(Node* node) {
+      node->~Node();
+      pool_.deallocate(node);
+    }
+    void release_all() noexcept { pool_.release(); }
+    void swap(handle& other) noexcept { pool_.swap(other.pool_); }
+    bool shares_with(const handle& other) const noexcept {
+      return this == &other;
+    }
+    // копия контейнера заводит свой пул
+    pool_allocator get_allocator() const noexcept { return {}; }
+
+   private:
+    node_pool<Node> pool_;
+  };
+};
+
+// узлы берутся из shared_pool, переданного конструктору контейнера:
+//   s21::shared_pool pool;
+//   s21::list<int, s21::shared_pool_allocator> a(pool), b(pool);
+// Без пула (конструктор по умолчанию, перемещенный контейнер) узлы
+// выделяются через new/delete, как у node_allocator
+struct shared_pool_allocator {
+  shared_pool_allocator() noexcept : pool(nullptr) {}
+  shared_pool_allocator(shared_pool& shared) noexcept : pool(&shared) {}
+
+  shared_pool* pool;
+
+  template <typename Node>
+  class handle {
+   public:
+    // блоки пула общие, освободить их может только сам пул
+    static constexpr bool kBulkRelease = false;
+
+    handle() noexcept : owner_(nullptr), pool_(nullptr) {}
+    explicit handle(const shared_pool_allocator& alloc)
+        : owner_(alloc.pool),
+          pool_(owner_ ? &owner_->template get<Node>() : nullptr) {}
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+      if (pool_ == nullptr) return new Node{std::forward<Args>(args)...};
+      void* ptr = pool_->allocate();
+      try {
+        return new (ptr) Node{std::forward<Args>(args)...};
+      } catch (...) {
+        pool_->deallocate(ptr);
+        throw;
+      }
+    }
+    void destroy(Node* node) {
+      if (pool_ == nullptr) {
+        delete node;
+        return;
+      }
+      node->~Node();
+      pool_->deallocate(node);
+    }
+    void release_all() noexcept {}
+    void swap(handle& other) noexcept {
+      std::swap(owner_, other.owner_);
+      std::swap(pool_, other.pool_);
+    }
+    bool shares_with(const handle& other) const noexcept {
+      return pool_ == other.pool_;
+    }
+    shared_pool_allocator get_allocator() const noexcept {
+      return owner_ ? shared_pool_allocator(*owner_) : shared_pool_allocator();
+    }
+
+   private:
+    shared_pool* owner_;
+    node_pool<Node>* pool_;
+  };
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef CPP_S21_CONTAINERS_PRIORITY_QUEUE_H
+#define CPP_S21_CONTAINERS_PRIORITY_QUEUE_H
+
+#include <functional>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+#include "s21_iterator_traits.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Очередь с приоритетом - d-арная куча в Container (по умолчанию
+// s21::vector). На вершине элемент, для которого comp(x, top) ложно для
+// всех x, т.е. с std::less - наибольший. Arity > 2 делает кучу ниже:
+// pop смотрит больше детей за шаг, но они лежат рядом в одной строке кэша,
+// а push проходит меньше уровней.
+// Container нужны operator[], front, push_back, emplace_back, pop_back,
+// size, empty, swap, end с insert(pos, first, last) и конструктор из
+// initializer_list.
+template <typename T, typename Container = s21::vector<T>,
+          typename Compare = std::less<T>, size_t Arity = 2>
+class priority_queue {
+  static_assert(Arity >= 2, "heap arity must be at least 2");
+
+ public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  priority_queue() = default;
+  explicit priority_queue(const Compare &comp) : c_(), comp_(comp) {}
+  // куча строится за O(n) просеиванием снизу вверх
+  template <typename InputIt,
+            typename = std::enable_if_t<is_iterator_of_v<InputIt, T>>>
+  priority_queue(InputIt first, InputIt last,
+                 const Compare &comp = Compare())
+      : c_(), comp_(comp) {
+    c_.insert(c_.end(), first, last);
+    make_heap();
+  }
+  priority_queue(std::initializer_list<value_type> const &items,
+                 const Compare &comp = Compare())
+      : c_(items), comp_(comp) {
+    make_heap();
+  }
+
+  const_reference top() const {
+    if (c_.empty()) throw std::out_of_range("priority_queue is empty");
+    return c_.front();
+  }
+  bool empty() const { return c_.empty(); }
+  size_type size() const { return c_.size(); }
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    c_.emplace_back(std::forward<Args>(args)...);
+    sift_up(c_.size() - 1);
+  }
+  // последний элемент переносится в корень и просеивается вниз
+  void pop() {
+    if (c_.empty()) throw std::out_of_range("priority_queue is empty");
+    size_type last = c_.size() - 1;
+    if (last != 0) {
+      value_type value = std::move(c_[last]);
+      c_.pop_back();
+      sift_down(0, std::move(value));
+    } else {
+      c_.pop_back();
+    }
+  }
+  void swap(priority_queue &other) noexcept {
+    c_.swap(other.c_);
+    std::swap(comp_, other.comp_);
+  }
+
+ protected:
+  Container c_;
+  Compare comp_;
+
+ private:
+  static size_type parent(size_type index) { return (index - 1) / Arity; }
+  static size_type first_child(size_type index) {
+    return index * Arity + 1;
+  }
+
+  void make_heap() {
+    size_type count = c_.size();
+    if (count < 2) return;
+    for (size_type index = parent(count - 1) + 1; index-- > 0;) {
+      value_type value = std::move(c_[index]);
+      sift_down(index, std::move(value));
+    }
+  }
+
+  // элементы сдвигаются в дырку, новый записывается один раз в конце
+  void sift_up(size_type index) {
+    if (index == 0) return;
+    value_type value = std::move(c_[index]);
+    while (index > 0) {
+      size_type up = parent(index);
+      if (!comp_(c_[up], value)) break;
+      c_[index] = std::move(c_[up]);
+      index = up;
+    }
+    c_[index] = std::move(value);
+  }
+  // value ставится в дырку index и опускается до своего места
+  void sift_down(size_type index, value_type &&value) {
+    size_type count = c_.size();
+    for (;;) {
+      size_type child = first_child(index);
+      if (child >= count) break;
+      size_type last = child + Arity < count ? child + Arity : count;
+      size_type best = child;
+      for (size_type other = child + 1; other < last; other++) {
+        if (comp_(c_[best], c_[other])) best = other;
+      }
+      if (!comp_(value, c_[best])) break;
+      c_[index] = std::move(c_[best]);
+      index = best;
+    }
+    c_[index] = std::move(value);
+  }
+};
+
+}  // namespace s21
+#endif
@@ -2,9 +2,14 @@
 #define CPP_S21_CONTAINERS_QUEUE_H
 
 #include <iostream>
+#include <new>
+#include <utility>
 
 namespace s21 {
 
+// Очередь на кольцевом буфере: элементы лежат в одном непрерывном блоке,
+// емкость - степень двойки, поэтому переход через край - это маска индекса.
+// push/pop не выделяют память, пока буфер не заполнен.
 template <typename T>
 class queue {
  public:
@@ -13,44 +18,25 @@ class queue {
   using const_reference = const T&;
   using size_type = size_t;
 
-  queue() noexcept : head_(nullptr), tail_(nullptr), size_(0) {}
-  queue(std::initializer_list<value_type> const& items) noexcept
-      : head_(nullptr), tail_(nullptr), size_(0) {
-    for (auto el : items) {
+  queue() noexcept : data_(nullptr), head_(0), size_(0), capacity_(0) {}
+  queue(std::initializer_list<value_type> const& items) : queue() {
+    reserve(items.size());
+    for (const_reference el : items) {
       this->push(el);
     }
   }
-  queue(const queue& q) : head_(nullptr), tail_(nullptr), size_(0) {
-    *this = q;
-  }
-  queue(queue&& q) : head_(q.head_), tail_(q.tail_), size_(q.size_) {
-    q.head_ = nullptr;
-    q.tail_ = nullptr;
-    q.size_ = 0;
-  }
+  queue(const queue& q) : queue() { *this = q; }
+  queue(queue&& q) noexcept : queue() { this->swap(q); }
 
   ~queue() {
-    while (this->head_ != nullptr) {
-      Node_* temp_queue = this->head_;
-      this->head_ = this->head_->next_;
-      delete temp_queue;
-    }
-    this->size_ = 0;
+    destroy_all();
+    ::operator delete(data_);
   }
 
-  queue<T>& operator=(queue&& q) {
+  queue<T>& operator=(queue&& q) noexcept {
     if (this != &q) {
-      while (this->head_ != nullptr) {
-        this->pop();
-      }
-
-      this->head_ = q.head_;
-      this->tail_ = q.tail_;
-      this->size_ = q.size_;
-
-      q.head_ = nullptr;
-      q.tail_ = nullptr;
-      q.size_ = 0;
+      destroy_all();
+      this->swap(q);
     }
 
     return *this;
@@ -59,83 +45,113 @@ class queue {
   queue<T>& operator=(const queue& q) {
     if (this != &q) {
       // Очищаем текущую очередь
-      while (this->head_ != nullptr) {
-        this->pop();
-      }
+      destroy_all();
 
-      // Копируем элементы из очереди q
-      Node_* current = q.head_;
-      while (current != nullptr) {
-        this->push(current->value_);
-        current = current->next_;
+      // Копируем элементы из очереди q в порядке от головы к хвосту
+      reserve(q.size_);
+      for (size_type i = 0; i < q.size_; i++) {
+        this->push(q.at_offset(i));
       }
     }
 
     return *this;
   }
 
-  const_reference front() { return this->head_->value_; }
-  const_reference back() { return this->tail_->value_; }
+  const_reference front() { return at_offset(0); }
+  const_reference back() { return at_offset(size_ - 1); }
 
   bool empty() { return this->size_ == 0; }
   size_type size() { return this->size_; }
 
-  void push(const_reference value) {
-    Node_* new_node = new Node_(value);
-
-    if (this->head_ == nullptr) {  // если это первый элемент, устанавливаю
-                                   // указатели head tail на начало.
-      this->head_ = new_node;
-      this->tail_ = new_node;
-    } else {  // если уже head не пустой, инициализирую next для связки с
-              // прошлым элементом и вставляю новый элемент.
-      this->tail_->next_ =
-          new_node;  // раньше был this->tail = this->tail->next что
-                     // неправильно, тк я не связывал очередь друг с
-                     // другом(прошлый с нынешним)
-      // и в конечном счете у меня оставалось только 2 элемета в очереди,
-      // остальные просто терялись (обнаружил на pop())
-      this->tail_ = new_node;
+  void push(const_reference value) { emplace(value); }
+  void push(value_type&& value) { emplace(std::move(value)); }
+  // элемент конструируется прямо в ячейке буфера из аргументов T
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    if (size_ == capacity_) {
+      // аргументы могут ссылаться на элементы старого буфера
+      value_type temp(std::forward<Args>(args)...);
+      grow();
+      new (data_ + index(size_)) value_type(std::move(temp));
+    } else {
+      new (data_ + index(size_)) value_type(std::forward<Args>(args)...);
     }
-    this->size_++;
+    size_++;
   }
 
   void pop() {
-    Node_* temp_queue = this->head_;
-    this->head_ = this->head_->next_;
-    delete temp_queue;
-    this->size_--;
-
-    if (this->head_ == nullptr) {
-      this->tail_ = nullptr;
-    }
+    data_[head_].~value_type();
+    head_ = index(1);
+    size_--;
   }
 
-  void swap(queue& other) {
+  void swap(queue& other) noexcept {
+    std::swap(this->data_, other.data_);
     std::swap(this->head_, other.head_);
-    std::swap(this->tail_, other.tail_);
     std::swap(this->size_, other.size_);
+    std::swap(this->capacity_, other.capacity_);
   }
   template <typename... Args>
   void insert_many_back(Args&&... args) {
-    std::initializer_list<value_type> arguments{args...};
-    for (value_type elem : arguments) {
-      this->push(elem);
-    }
+    reserve(size_ + sizeof...(args));
+    (this->push(std::forward<Args>(args)), ...);
   }
 
  private:
-  typedef struct Node_ {
-    value_type value_;
-    Node_* next_;
-    Node_(value_type value) : value_(value), next_(nullptr) {}
-  } Node_;
-
-  Node_* head_;
-  Node_* tail_;
+  static constexpr size_type kMinCapacity = 8;
+
+  // позиция offset-го от головы элемента в буфере
+  size_type index(size_type offset) const {
+    return (head_ + offset) & (capacity_ - 1);
+  }
+  const_reference at_offset(size_type offset) const {
+    return data_[index(offset)];
+  }
+  reference at(size_type offset) { return data_[index(offset)]; }
+
+  // емкость под count элементов, округленная до степени двойки
+  void reserve(size_type count) {
+    if (count <= capacity_) return;
+    size_type new_capacity = capacity_ ? capacity_ : kMinCapacity;
+    while (new_capacity < count) new_capacity *= 2;
+    relocate(new_capacity);
+  }
+  void grow() { relocate(capacity_ ? capacity_ * 2 : kMinCapacity); }
+
+  // переносит элементы в новый буфер, голова оказывается в нуле. Старые
+  // элементы разрушаются только после того, как построены все новые: если
+  // копия бросит, очередь остается прежней
+  void relocate(size_type new_capacity) {
+    value_type* new_data =
+        static_cast<value_type*>(::operator new(new_capacity * sizeof(T)));
+    size_type done = 0;
+    try {
+      for (; done < size_; done++) {
+        new (new_data + done) value_type(std::move_if_noexcept(at(done)));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < done; i++) new_data[i].~value_type();
+      ::operator delete(new_data);
+      throw;
+    }
+    for (size_type i = 0; i < size_; i++) at(i).~value_type();
+    ::operator delete(data_);
+    data_ = new_data;
+    head_ = 0;
+    capacity_ = new_capacity;
+  }
+
+  void destroy_all() {
+    while (size_ != 0) pop();
+    head_ = 0;
+  }
+
+  value_type* data_;
+  size_type head_;  // индекс первого элемента
   size_type size_;
+  size_type capacity_;  // 0 или степень двойки
 };
 
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
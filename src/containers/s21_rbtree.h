@@ -1,28 +1,51 @@
 #ifndef CPP_S21_CONTAINERS_RBTREE_H
 #define CPP_S21_CONTAINERS_RBTREE_H
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
 
+#include "s21_node_pool.h"
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key, typename T = Key>
+// Alloc - политика выделения узлов (node_allocator или pool_allocator).
+// Ranked - узел помнит размер своего поддерева, что дает nth и rank за
+// O(log n); за это вставка и удаление обновляют размеры на пути к корню и
+// узел длиннее на size_t, поэтому режим включается только по запросу.
+template <typename Key, typename T = Key, typename Alloc = node_allocator,
+          bool Ranked = false>
 class rbtree {
  protected:
   enum colors { RED, BLACK };
-  struct Node {
-    Node *left, *right, *parent;
+  template <bool Weighted, typename = void>
+  struct NodeOf {
+    NodeOf *left, *right, *parent;
     colors color;
     Key key;
     T value;
   };
+  template <typename Unused>
+  struct NodeOf<true, Unused> {
+    NodeOf *left, *right, *parent;
+    colors color;
+    Key key;
+    T value;
+    size_t weight = 1;  // число узлов в поддереве, включая этот
+  };
+  using Node = NodeOf<Ranked>;
 
  private:
   Node* root;
+  Node* rightmost_;  // последний узел: вставка в конец по подсказке за O(1)
+  Node* leftmost_;   // первый узел: begin() за O(1)
+  size_t size_;  // число элементов, обновляется при вставке и удалении
+  typename Alloc::template handle<Node> nodes_;
 
  protected:
+  // первый узел без спуска от корня; nullptr у пустого дерева
+  Node* leftmost() const { return leftmost_; }
   Node* getNode(const std::pair<Key, T>& value) {
     return getNodeRecursive(root, value);
   }
@@ -40,6 +63,95 @@ class rbtree {
     return getNodeRecursive(node->right, value);
   }
 
+  // спуск от корня: первый (самый левый) узел с ключом key или nullptr
+  Node* findNode(const Key& key) const {
+    Node *node = root, *found = nullptr;
+    while (node != nullptr) {
+      if (key < node->key) {
+        node = node->left;
+      } else if (key > node->key) {
+        node = node->right;
+      } else {
+        found = node;
+        node = node->left;
+      }
+    }
+    return found;
+  }
+
+  // спуск от корня: первый узел с ключом не меньше key (lower) или
+  // больше key (upper), nullptr - если такого нет. Нужен только operator<
+  Node* lowerBoundNode(const Key& key) const {
+    Node *node = root, *found = nullptr;
+    while (node != nullptr) {
+      if (node->key < key) {
+        node = node->right;
+      } else {
+        found = node;
+        node = node->left;
+      }
+    }
+    return found;
+  }
+  Node* upperBoundNode(const Key& key) const {
+    Node *node = root, *found = nullptr;
+    while (node != nullptr) {
+      if (key < node->key) {
+        found = node;
+        node = node->left;
+      } else {
+        node = node->right;
+      }
+    }
+    return found;
+  }
+
+  // k-й по порядку узел (с нуля) или nullptr: спуск по размерам поддеревьев
+  Node* nthNode(size_t k) const {
+    static_assert(Ranked, "nth needs rbtree with Ranked = true");
+    Node* node = root;
+    while (node != nullptr) {
+      size_t left = weightOf(node->left);
+      if (k < left) {
+        node = node->left;
+      } else if (k == left) {
+        return node;
+      } else {
+        k -= left + 1;
+        node = node->right;
+      }
+    }
+    return nullptr;
+  }
+
+  // следующий по порядку узел или nullptr
+  static Node* nextNode(Node* node) {
+    if (node->right) {
+      node = node->right;
+      while (node->left) node = node->left;
+      return node;
+    }
+    while (node->parent && node == node->parent->right) node = node->parent;
+    return node->parent;
+  }
+  // предыдущий по порядку узел или nullptr
+  static Node* prevNode(Node* node) {
+    if (node->left) {
+      node = node->left;
+      while (node->right) node = node->right;
+      return node;
+    }
+    while (node->parent && node == node->parent->left) node = node->parent;
+    return node->parent;
+  }
+
+  static size_t weightOf(const Node* node) {
+    return node ? node->weight : 0;
+  }
+  static void updateWeight(Node* node) {
+    node->weight = 1 + weightOf(node->left) + weightOf(node->right);
+  }
+
  public:
   class TreeIterator {
     friend class rbtree;
@@ -82,34 +194,26 @@ class rbtree {
 
    protected:
     Node* decrement_operator(Node* node_ptr) {
-      if (node_ptr->left == nullptr) {
-        if (node_ptr->parent && node_ptr->key >= node_ptr->parent->key)
-          node_ptr = node_ptr->parent;
-        else {
-          while (node_ptr->parent && node_ptr->key <= node_ptr->parent->key) {
-            node_ptr = node_ptr->parent;
-          }
-          node_ptr = node_ptr->parent;
-        }
-      } else if (node_ptr->left) {
+      if (node_ptr->left) {
         node_ptr = node_ptr->left;
         while (node_ptr->right) node_ptr = node_ptr->right;
+      } else {  // поднимаемся, пока идем из левого поддерева
+        while (node_ptr->parent && node_ptr == node_ptr->parent->left) {
+          node_ptr = node_ptr->parent;
+        }
+        node_ptr = node_ptr->parent;
       }
       return node_ptr;
     }
     Node* increment_operator(Node* node_ptr) {
-      if (node_ptr->right == nullptr) {
-        if (node_ptr->parent && node_ptr->key <= node_ptr->parent->key)
-          node_ptr = node_ptr->parent;
-        else {
-          while (node_ptr->parent && node_ptr->key >= node_ptr->parent->key) {
-            node_ptr = node_ptr->parent;
-          }  // дошел до старшего
-          node_ptr = node_ptr->parent;
-        }
-      } else if (node_ptr->right) {
+      if (node_ptr->right) {
         node_ptr = node_ptr->right;
         while (node_ptr->left) node_ptr = node_ptr->left;
+      } else {  // поднимаемся, пока идем из правого поддерева
+        while (node_ptr->parent && node_ptr == node_ptr->parent->right) {
+          node_ptr = node_ptr->parent;
+        }  // дошел до старшего
+        node_ptr = node_ptr->parent;
       }
       return node_ptr;
     }
@@ -124,8 +228,25 @@ class rbtree {
   using const_iterator = ConstTreeIterator;
   using size_type = size_t;
 
-  rbtree() : root(nullptr) {}
+  rbtree() : root(nullptr), rightmost_(nullptr), leftmost_(nullptr), size_(0) {}
+  explicit rbtree(const Alloc& alloc)
+      : root(nullptr),
+        rightmost_(nullptr),
+        leftmost_(nullptr),
+        size_(0),
+        nodes_(alloc) {}
+  // перемещение забирает корень и узлы целиком, элементы не трогаются
+  rbtree(rbtree&& other) noexcept : rbtree() { swap(other); }
   ~rbtree() { clear(); }
+  rbtree& operator=(rbtree&& other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+  // политика выделения узлов, с которой построено дерево
+  Alloc get_allocator() const { return nodes_.get_allocator(); }
 
   Node* findMin() {
     Node* min_node = root;
@@ -156,39 +277,21 @@ class rbtree {
   }
 
   std::pair<iterator, bool> create_tree(const std::pair<Key, T>& value) {
-    root = new Node;
+    root = leftmost_ = rightmost_ = create_node(value);
     root->color = BLACK;
-    root->key = value.first;
-    root->value = value.second;
-    root->left = nullptr;
-    root->right = nullptr;
-    root->parent = nullptr;
+    size_ = 1;
     return {iterator(root), true};
   }
 
   Node* create_node(const std::pair<Key, T>& value) {
-    Node* newNode = new Node;
-    newNode->color = RED;
-    newNode->key = value.first;
-    newNode->value = value.second;
-    newNode->left = nullptr;
-    newNode->right = nullptr;
-    newNode->parent = nullptr;
-    return newNode;
-  }
-  iterator begin() {
-    if (size() == 0) return end();
-    Node* ptr = findMin();
-    return iterator(ptr);
+    return nodes_.create(nullptr, nullptr, nullptr, RED, value.first,
+                         value.second);
   }
+  iterator begin() { return iterator(leftmost_); }
 
   iterator end() { return iterator(nullptr); }
 
-  const_iterator begin() const {
-    if (size() == 0) return end();
-    Node* ptr = findMin();
-    return const_iterator(ptr);
-  }
+  const_iterator begin() const { return const_iterator(leftmost_); }
 
   const_iterator end() const { return const_iterator(nullptr); }
 
@@ -215,7 +318,7 @@ class rbtree {
             node = parent;
             rotateLeft(node);  // при повороте родитель и сын становятся сыном и
                                // родителем
-            node->color = BLACK;  // node теперь родитель
+            node->parent->color = BLACK;  // бывший сын теперь родитель
           } else
             parent->color = BLACK;
           ded->color = RED;
@@ -232,7 +335,7 @@ class rbtree {
           if (parent->left == node) {
             node = parent;
             rotateRight(node);
-            node->color = BLACK;
+            node->parent->color = BLACK;
           } else
             parent->color = BLACK;
           ded->color = RED;
@@ -245,36 +348,34 @@ class rbtree {
 
   std::pair<iterator, bool> insert(const std::pair<Key, T>& value) {
     if (root == nullptr) return create_tree(value);
-    Node *current_node = root, *current_parent = nullptr,
-         *newNode = create_node(value);
-    bool duplicate = false;
+    Node* newNode = create_node(value);
+    link_node(newNode);
+    ++size_;
+    return {iterator(newNode), true};
+  }
+
+  // подвешивает готовый узел к непустому дереву и балансирует
+  void link_node(Node* newNode) {
+    Node *current_node = root, *current_parent = nullptr;
     while (current_node != nullptr) {
       current_parent = current_node;
-      if (value.first < current_node->key) {
+      if constexpr (Ranked) current_node->weight++;
+      // дубликат уходит вправо, то есть встает после уже вставленных копий
+      if (newNode->key < current_node->key)
         current_node = current_node->left;
-      } else if (value.first > current_node->key) {
-        current_node = current_node->right;
-      } else {
-        duplicate = true;
-        newNode->parent = current_node;
-
-        if (current_node->left) {
-          newNode->left = current_node->left;
-          current_node->left->parent = newNode;
-        }
-        current_node->left = newNode;
-        break;
-      }
-    }
-    if (!duplicate) {
-      newNode->parent = current_parent;
-      if (newNode->key <= current_parent->key)
-        current_parent->left = newNode;
       else
-        current_parent->right = newNode;
+        current_node = current_node->right;
     }
+    newNode->parent = current_parent;
+    if (newNode->key < current_parent->key)
+      current_parent->left = newNode;
+    else
+      current_parent->right = newNode;
+    if (current_parent == rightmost_ && newNode == current_parent->right)
+      rightmost_ = newNode;
+    if (current_parent == leftmost_ && newNode == current_parent->left)
+      leftmost_ = newNode;
     InsertFix(newNode);
-    return {iterator(newNode), true};
   }
 
   void rotateLeft(Node* node) {
@@ -292,6 +393,10 @@ class rbtree {
       node->parent->right = new_parent;
     node->parent = new_parent;
     new_parent->left = node;
+    if constexpr (Ranked) {
+      new_parent->weight = node->weight;
+      updateWeight(node);
+    }
   }
   void rotateRight(Node* node) {
     Node* new_parent = node->left;
@@ -308,148 +413,204 @@ class rbtree {
       node->parent->right = new_parent;
     node->parent = new_parent;
     new_parent->right = node;
+    if constexpr (Ranked) {
+      new_parent->weight = node->weight;
+      updateWeight(node);
+    }
   }
 
-  void fixDelete(Node* parent) {
-    int direction = parent->left ? 0 : 1;  // 0 - left 1 - right
-    Node* node =
-        parent->left ? parent->left : parent->right;  // node - брат удаленного
-    if (node->color == BLACK) {                       // ЧЕРНЫЙ БРАТ
-
-      if (node->right && node->right->color == RED) {
-        node->color = parent->color;
-        parent->color = BLACK;
-        node->right->color = BLACK;
-        rotateLeft(parent);
-      } else if (node->left && node->right && node->left->color == RED &&
-                 node->right->color == BLACK) {
-        std::swap(node->left->color, node->color);
-        rotateRight(node);
-        fixDelete(parent);  // переход к случаю выше
-      } else {
-        node->color = RED;
-        bool flag_fix = parent->color == BLACK;
-        // std::cout << flag_fix;
-        parent->color = BLACK;
-        if (node->left) node->left->color = BLACK;
-        if (flag_fix && parent != root) {
-          fixDelete(parent);
+  // замена поддерева u поддеревом v у родителя u
+  void transplant(Node* u, Node* v) {
+    if (u->parent == nullptr)
+      root = v;
+    else if (u == u->parent->left)
+      u->parent->left = v;
+    else
+      u->parent->right = v;
+    if (v) v->parent = u->parent;
+  }
+
+  static bool isBlack(Node* node) {
+    return node == nullptr || node->color == BLACK;
+  }
+
+  // node занял место удаленного черного узла (может быть nullptr),
+  // parent - его родитель
+  void fixDelete(Node* node, Node* parent) {
+    while (node != root && isBlack(node)) {
+      if (node == parent->left) {
+        Node* brother = parent->right;
+        if (brother->color == RED) {  // красный брат - сводим к черному
+          brother->color = BLACK;
+          parent->color = RED;
+          rotateLeft(parent);
+          brother = parent->right;
+        }
+        if (isBlack(brother->left) && isBlack(brother->right)) {
+          brother->color = RED;  // поднимаем проблему к родителю
+          node = parent;
+          parent = node->parent;
+        } else {
+          if (isBlack(brother->right)) {  // ближний племянник красный
+            brother->left->color = BLACK;
+            brother->color = RED;
+            rotateRight(brother);
+            brother = parent->right;
+          }
+          brother->color = parent->color;
+          parent->color = BLACK;
+          brother->right->color = BLACK;
+          rotateLeft(parent);
+          node = root;
+        }
+      } else {  // то же самое зеркально
+        Node* brother = parent->left;
+        if (brother->color == RED) {
+          brother->color = BLACK;
+          parent->color = RED;
+          rotateRight(parent);
+          brother = parent->left;
+        }
+        if (isBlack(brother->left) && isBlack(brother->right)) {
+          brother->color = RED;
+          node = parent;
+          parent = node->parent;
+        } else {
+          if (isBlack(brother->left)) {
+            brother->right->color = BLACK;
+            brother->color = RED;
+            rotateLeft(brother);
+            brother = parent->left;
+          }
+          brother->color = parent->color;
+          parent->color = BLACK;
+          brother->left->color = BLACK;
+          rotateRight(parent);
+          node = root;
         }
       }
-    } else {
-      parent->color = RED;
-      node->color = BLACK;
-      if (node->left) {
-        node->left->color = BLACK;
-      }
-      if (node->right) {
-        node->right->color = BLACK;
-      }
-      if (direction == 0) {
-        rotateRight(parent);
-      } else {
-        rotateLeft(parent);
-      }
-      fixDelete(parent);
     }
-    //}
+    if (node) node->color = BLACK;
   }
 
+  // узел выпутывается из дерева перевязкой указателей, ключи и значения
+  // других узлов не перемещаются, поэтому их итераторы остаются валидными
   void deleteNode(Node* node) {
-    if (!node->left && !node->right) {  // 0
-      if (node->color == RED) {
-        if (node->parent->left == node)
-          node->parent->left = nullptr;
-        else
-          node->parent->right = nullptr;
-        delete node;
-      } else {
-        if (node == root) {
-          delete node;
-          root = nullptr;
-        } else {
-          Node* parent = node->parent;
-          if (node->parent->left == node)
-            node->parent->left = nullptr;
-          else
-            node->parent->right = nullptr;
-          delete node;
-          fixDelete(parent);
-        }
+    Node *child = nullptr, *child_parent = node->parent;
+    colors removed_color = node->color;
+    if (node == rightmost_) rightmost_ = prevNode(node);
+    if (node == leftmost_) leftmost_ = nextNode(node);
+    if constexpr (Ranked) {
+      // из дерева физически уходит node или, при двух сыновьях, следующий
+      // за ним узел; поддеревья на пути от этого места к корню теряют по
+      // узлу
+      Node* removed = node;
+      if (node->left && node->right) {
+        removed = node->right;
+        while (removed->left) removed = removed->left;
       }
-    } else if ((!node->left && node->right) ||
-               (node->left && !node->right)) {  // 1
-      if (node->color == RED) {
-        throw std::out_of_range(
-            "ERROR такой случай в правильном дереве невозможен");
+      for (Node* up = removed->parent; up; up = up->parent) up->weight--;
+    }
+    if (node->left == nullptr) {
+      child = node->right;
+      transplant(node, node->right);
+    } else if (node->right == nullptr) {
+      child = node->left;
+      transplant(node, node->left);
+    } else {  // 2 сына - на место node встает следующий за ним узел
+      Node* next = node->right;
+      while (next->left) next = next->left;
+      removed_color = next->color;
+      child = next->right;
+      if (next->parent == node) {
+        child_parent = next;
       } else {
-        Node* sswap = node->right ? node->right : node->left;
-        std::swap(node->key, sswap->key);
-        std::swap(node->value, sswap->value);
-        deleteNode(sswap);
+        child_parent = next->parent;
+        transplant(next, next->right);
+        next->right = node->right;
+        next->right->parent = next;
       }
-    } else {  // 2
-      Node* update = node->left;
-      while (update->right) {
-        update = update->right;
-      }
-      std::swap(update->key, node->key);
-      std::swap(update->value, node->value);
-      deleteNode(update);
+      transplant(node, next);
+      next->left = node->left;
+      next->left->parent = next;
+      next->color = node->color;
+      if constexpr (Ranked) next->weight = node->weight;
     }
+    nodes_.destroy(node);
+    if (removed_color == BLACK) fixDelete(child, child_parent);
   }
   void erase(iterator pos) {
     if (pos != nullptr) {
-      Node* node = getNode({(*pos).first, (*pos).second});
-      deleteNode(node);
+      deleteNode(pos.node_ptr);
+      --size_;
     }
   }
 
   void clear() {
-    helper_clear(this->root);
+    // пул с тривиальными узлами освобождается целиком, без обхода дерева
+    if constexpr (decltype(nodes_)::kBulkRelease)
+      nodes_.release_all();
+    else
+      helper_clear(this->root);
     this->root = nullptr;
+    this->rightmost_ = nullptr;
+    this->leftmost_ = nullptr;
+    this->size_ = 0;
   }
   void helper_clear(Node* node) {
     if (node != nullptr) {
       helper_clear(node->left);
       helper_clear(node->right);
-      delete node;
+      nodes_.destroy(node);
     }
   }
-  size_type size() { return helper_in_order(this->root); }
+  size_type size() const { return size_; }
+
+  void swap(rbtree& other) noexcept {
+    std::swap(root, other.root);
+    std::swap(rightmost_, other.rightmost_);
+    std::swap(leftmost_, other.leftmost_);
+    std::swap(size_, other.size_);
+    nodes_.swap(other.nodes_);
+  }
 
-  size_type size() const { return helper_in_order(this->root); }
+  // все элементы other переходят в дерево, равные ключи встают после своих
+  void merge(rbtree& other) { merge_nodes(other, false); }
 
-  size_type helper_in_order(Node* node) const {
-    if (node == nullptr) return 0;
-    return 1 + helper_in_order(node->left) + helper_in_order(node->right);
-  }
+  iterator find(const Key& key) { return iterator(findNode(key)); }
 
-  void swap(rbtree& other) { std::swap(root, other.root); }
+  bool contains(const Key& key) const { return findNode(key) != nullptr; }
 
-  void merge(rbtree& other) {
-    for (iterator it = other.begin(); it != other.end(); it++) {
-      this->insert({(*it).first, (*it).second});
-    }
-    other.clear();
+  // границы за O(log n), count - O(log n + k) для k равных ключей
+  iterator lower_bound(const Key& key) { return iterator(lowerBoundNode(key)); }
+  iterator upper_bound(const Key& key) { return iterator(upperBoundNode(key)); }
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return {lower_bound(key), upper_bound(key)};
   }
-
-  iterator find(const Key& key) {
-    for (iterator it = begin(); it != end(); it++) {
-      if ((*it).first == key) return it;
-    }
-    return iterator(nullptr);
+  size_type count(const Key& key) const {
+    size_type counter = 0;
+    const_iterator it(lowerBoundNode(key));
+    for (; it != end() && !(key < it.node_ptr->key); ++it) counter++;
+    return counter;
   }
-
-  bool contains(const Key& key) {
-    for (iterator it = begin(); it != end(); it++) {
-      if ((*it).first == key) {
-        return true;
+  // порядковые статистики за O(log n), только при Ranked: nth(k) - k-й
+  // элемент по порядку (с нуля) или end(), rank(key) - сколько элементов
+  // меньше key, т.е. номер lower_bound(key)
+  iterator nth(size_type k) { return iterator(nthNode(k)); }
+  size_type rank(const Key& key) const {
+    static_assert(Ranked, "rank needs rbtree with Ranked = true");
+    size_type less = 0;
+    for (Node* node = root; node != nullptr;) {
+      if (node->key < key) {
+        less += weightOf(node->left) + 1;
+        node = node->right;
+      } else {
+        node = node->left;
       }
     }
-    return false;
+    return less;
   }
-  bool empty() { return this->root == nullptr; }
+  bool empty() const { return this->size_ == 0; }
 
   size_type max_size() {
     return std::numeric_limits<size_type>::max() / sizeof(rbtree<Key, T>) / 2;
@@ -466,16 +627,349 @@ class rbtree {
   }
 
   void print() const { inorder(root); }
-  template <typename... Args>
-  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
-    s21::vector<std::pair<iterator, bool>> results;
 
-    for (const auto& el : {args...}) {
-      results.push_back(insert({el, el}));
+ protected:
+  // Вставка пачки для insert_many. Номера элементов сортируются по ключу
+  // (при равных ключах - по номеру, чтобы копии встали в порядке
+  // аргументов); для уникальных ключей из серии равных создается один
+  // узел, а совпадения с ключами дерева отсеиваются при встраивании.
+  // results[i] соответствует items[i].
+  template <typename ResultIt>
+  s21::vector<std::pair<ResultIt, bool>> insert_bulk(
+      s21::vector<std::pair<Key, T>>& items, bool unique) {
+    size_type count = items.size();
+    s21::vector<size_type> order, fresh_of;
+    order.reserve(count);
+    fresh_of.reserve(count);
+    for (size_type i = 0; i < count; i++) {
+      order.push_back(i);
+      fresh_of.push_back(0);
+    }
+    // уже упорядоченный вход не сортируется: узлы создаются по порядку и
+    // дерево собирается за O(n)
+    bool sorted = true;
+    for (size_type i = 1; i < count && sorted; i++) {
+      sorted = !(items[i].first < items[i - 1].first);
+    }
+    if (!sorted) {
+      std::sort(order.data(), order.data() + count,
+                [&items](size_type a, size_type b) {
+                  if (items[a].first < items[b].first) return true;
+                  if (items[b].first < items[a].first) return false;
+                  return a < b;
+                });
     }
 
+    // fresh[f] - новый узел, creator[f] - номер элемента, который его дал
+    s21::vector<Node*> fresh;
+    s21::vector<size_type> creator;
+    fresh.reserve(count);
+    creator.reserve(count);
+    try {
+      for (size_type k = 0; k < count; k++) {
+        std::pair<Key, T>& item = items[order[k]];
+        if (!unique || fresh.empty() || !(fresh.back()->key == item.first)) {
+          fresh.push_back(nodes_.create(nullptr, nullptr, nullptr, RED,
+                                        std::move(item.first),
+                                        std::move(item.second)));
+          creator.push_back(order[k]);
+        }
+        fresh_of[order[k]] = fresh.size() - 1;
+      }
+    } catch (...) {
+      for (size_type i = 0; i < fresh.size(); i++) nodes_.destroy(fresh[i]);
+      throw;
+    }
+    s21::vector<bool> inserted;
+    inserted.reserve(fresh.size());
+    for (size_type f = 0; f < fresh.size(); f++) inserted.push_back(true);
+    attach_sorted(fresh, inserted, unique);
+
+    // вставленным считается только первый элемент серии равных ключей
+    s21::vector<std::pair<ResultIt, bool>> results;
+    results.reserve(count);
+    for (size_type i = 0; i < count; i++) {
+      size_type f = fresh_of[i];
+      results.push_back({ResultIt(fresh[f]), inserted[f] && creator[f] == i});
+    }
     return results;
   }
+
+  // подвешивает к дереву новые узлы, отсортированные по ключу. Если новых
+  // узлов много (m log n >= n), дешевле слить их по порядку с узлами дерева
+  // и перевязать все дерево заново за O(n + m); узлы при этом не
+  // перемещаются, итераторы остаются валидными. Для уникальных ключей узел,
+  // ключ которого уже есть в дереве, удаляется, а fresh[i] заменяется
+  // найденным узлом и inserted[i] сбрасывается.
+  void attach_sorted(s21::vector<Node*>& fresh, s21::vector<bool>& inserted,
+                     bool unique) {
+    size_type count = fresh.size(), log_size = 1, added = count;
+    if (count == 0) return;
+    for (size_type n = size_; n > 1; n >>= 1) log_size++;
+
+    if (count * log_size >= size_) {
+      s21::vector<Node*> all;
+      all.reserve(size_ + count);
+      size_type j = 0;
+      for (iterator it = begin(); it != end(); ++it) {
+        // новые узлы с равным ключом встают после старых
+        while (j < count && fresh[j]->key < it.node_ptr->key) {
+          all.push_back(fresh[j++]);
+        }
+        if (unique && j < count && fresh[j]->key == it.node_ptr->key) {
+          nodes_.destroy(fresh[j]);
+          fresh[j] = it.node_ptr;
+          inserted[j++] = false;
+          added--;
+        }
+        all.push_back(it.node_ptr);
+      }
+      while (j < count) all.push_back(fresh[j++]);
+      root = build_balanced(all.data(), all.size());
+      rightmost_ = all.back();
+      leftmost_ = all.front();
+    } else {
+      for (size_type i = 0; i < count; i++) {
+        Node* same = unique ? link_unique(fresh[i]) : nullptr;
+        if (!unique) link_node(fresh[i]);
+        if (same != nullptr) {
+          nodes_.destroy(fresh[i]);
+          fresh[i] = same;
+          inserted[i] = false;
+          added--;
+        }
+      }
+    }
+    size_ += added;
+  }
+
+  // Вставка по подсказке: узел встает как можно ближе перед hint (nullptr
+  // - конец). Если ключ ложится между предшественником hint и hint, узел
+  // подвешивается прямо туда: у hint нет левого сына или у предшественника
+  // нет правого. Так вставка в конец или рядом с прошлой вставкой обходится
+  // без спуска от корня, остается InsertFix (в среднем O(1)); при Ranked
+  // размеры поддеревьев все равно обновляются до корня. Иначе - обычный
+  // спуск. При unique и уже имеющемся ключе узел не подвешивается и
+  // возвращается найденный узел, иначе nullptr.
+  Node* link_hint(Node* hint, Node* newNode, bool unique) {
+    if (root == nullptr) {
+      newNode->color = BLACK;
+      root = leftmost_ = rightmost_ = newNode;
+      return nullptr;
+    }
+    const Key& key = newNode->key;
+    Node* prev = hint ? prevNode(hint) : rightmost_;
+    bool fits = (prev == nullptr || prev->key < key ||
+                 (!unique && !(key < prev->key))) &&
+                (hint == nullptr || key < hint->key ||
+                 (!unique && !(hint->key < key)));
+    if (!fits) {
+      if (unique) return link_unique(newNode);
+      link_node(newNode);
+      return nullptr;
+    }
+    Node* parent = prev;
+    if (hint != nullptr && hint->left == nullptr) {
+      parent = hint;
+      hint->left = newNode;
+      if (hint == leftmost_) leftmost_ = newNode;
+    } else {
+      prev->right = newNode;
+      if (prev == rightmost_) rightmost_ = newNode;
+    }
+    newNode->parent = parent;
+    if constexpr (Ranked) {
+      for (; parent != nullptr; parent = parent->parent) parent->weight++;
+    }
+    InsertFix(newNode);
+    return nullptr;
+  }
+  // {узел, вставлен ли}: при unique и уже имеющемся ключе - найденный узел.
+  // key и value копируются или перемещаются прямо в узел
+  template <typename K, typename V>
+  std::pair<Node*, bool> insert_hint(iterator hint, bool unique, K&& key,
+                                     V&& value) {
+    Node* node = nodes_.create(nullptr, nullptr, nullptr, RED,
+                               std::forward<K>(key), std::forward<V>(value));
+    Node* same = link_hint(hint.node_ptr, node, unique);
+    if (same != nullptr) {
+      nodes_.destroy(node);
+      return {same, false};
+    }
+    ++size_;
+    return {node, true};
+  }
+
+  // копия дерева other той же формы и окраски: каждый узел создается
+  // один раз, без спусков и InsertFix
+  void copy_from(const rbtree& other) {
+    clear();
+    if (other.root == nullptr) return;
+    root = clone_subtree(other.root, nullptr);
+    rightmost_ = findMax();
+    leftmost_ = findMin();
+    size_ = other.size_;
+  }
+  Node* clone_subtree(const Node* source, Node* parent) {
+    Node* node = nodes_.create(nullptr, nullptr, parent, source->color,
+                               source->key, source->value);
+    if constexpr (Ranked) node->weight = source->weight;
+    try {
+      if (source->left) node->left = clone_subtree(source->left, node);
+      if (source->right) node->right = clone_subtree(source->right, node);
+    } catch (...) {
+      helper_clear(node);
+      throw;
+    }
+    return node;
+  }
+
+  // Слияние за O(n + m): оба дерева раскладываются в упорядоченные массивы
+  // узлов, сливаются и перевязываются build_balanced. Если other мал
+  // (m log n < n), его узлы подвешиваются по одному. При unique узлы с
+  // уже имеющимся ключом остаются в other, как у std::set::merge. Узлы
+  // перевязываются, если у деревьев общий пул; иначе сначала создаются
+  // копии, и при исключении оба дерева остаются прежними.
+  void merge_nodes(rbtree& other, bool unique) {
+    if (this == &other || other.root == nullptr) return;
+    size_type log_size = 1;
+    for (size_type n = size_; n > 1; n >>= 1) log_size++;
+    bool relink = other.size_ * log_size >= size_;
+    s21::vector<Node*> mine, theirs, taken, kept;
+    if (relink) flatten(root, mine, size_);
+    flatten(other.root, theirs, other.size_);
+
+    // какие узлы other уходят, какие остаются
+    taken.reserve(theirs.size());
+    size_type j = 0;
+    for (Node* node : theirs) {
+      bool present = false;
+      if (unique && relink) {
+        while (j < mine.size() && mine[j]->key < node->key) j++;
+        present = j < mine.size() && !(node->key < mine[j]->key);
+      } else if (unique) {
+        present = findNode(node->key) != nullptr;
+      }
+      (present ? kept : taken).push_back(node);
+    }
+    if (taken.empty()) return;
+
+    bool shared = nodes_.shares_with(other.nodes_);
+    s21::vector<Node*> fresh;
+    if (!shared) {
+      fresh.reserve(taken.size());
+      try {
+        for (Node* node : taken) {
+          fresh.push_back(nodes_.create(nullptr, nullptr, nullptr, RED,
+                                        node->key, node->value));
+        }
+      } catch (...) {
+        for (Node* node : fresh) nodes_.destroy(node);
+        throw;
+      }
+    }
+    s21::vector<Node*>& moving = shared ? taken : fresh;
+
+    if (relink) {
+      s21::vector<Node*> all;
+      all.reserve(mine.size() + moving.size());
+      size_type k = 0;
+      for (Node* node : mine) {  // равные ключи из other - после своих
+        while (k < moving.size() && moving[k]->key < node->key) {
+          all.push_back(moving[k++]);
+        }
+        all.push_back(node);
+      }
+      while (k < moving.size()) all.push_back(moving[k++]);
+      root = build_balanced(all.data(), all.size());
+      rightmost_ = all.back();
+      leftmost_ = all.front();
+    } else {  // дерево не пусто: иначе relink
+      for (Node* node : moving) {
+        node->left = node->right = nullptr;
+        node->color = RED;
+        if constexpr (Ranked) node->weight = 1;
+        link_node(node);
+      }
+    }
+    size_ += moving.size();
+
+    if (!shared) {
+      for (Node* node : taken) other.nodes_.destroy(node);
+    }
+    other.root = build_balanced(kept.data(), kept.size());
+    other.rightmost_ = kept.empty() ? nullptr : kept.back();
+    other.leftmost_ = kept.empty() ? nullptr : kept.front();
+    other.size_ = kept.size();
+  }
+  // узлы поддерева в порядке ключей
+  static void flatten(Node* node, s21::vector<Node*>& out, size_type count) {
+    out.reserve(count);
+    collect(node, out);
+  }
+  static void collect(Node* node, s21::vector<Node*>& out) {
+    while (node != nullptr) {
+      collect(node->left, out);
+      out.push_back(node);
+      node = node->right;
+    }
+  }
+
+  // как link_node, но если такой ключ уже есть, узел не подвешивается и
+  // возвращается найденный узел
+  Node* link_unique(Node* newNode) {
+    Node *current_node = root, *current_parent = nullptr;
+    while (current_node != nullptr) {
+      current_parent = current_node;
+      if (newNode->key < current_node->key)
+        current_node = current_node->left;
+      else if (current_node->key < newNode->key)
+        current_node = current_node->right;
+      else
+        return current_node;
+    }
+    newNode->parent = current_parent;
+    if (newNode->key < current_parent->key)
+      current_parent->left = newNode;
+    else
+      current_parent->right = newNode;
+    if (current_parent == rightmost_ && newNode == current_parent->right)
+      rightmost_ = newNode;
+    if (current_parent == leftmost_ && newNode == current_parent->left)
+      leftmost_ = newNode;
+    if constexpr (Ranked) {
+      for (Node* node = current_parent; node; node = node->parent)
+        node->weight++;
+    }
+    InsertFix(newNode);
+    return nullptr;
+  }
+
+  // связывает узлы, упорядоченные по ключу, в сбалансированное дерево:
+  // середина - корень, половины - поддеревья. Все листья оказываются на
+  // двух нижних уровнях, поэтому узлы самого нижнего уровня красятся
+  // красным, остальные - черным, и черная высота везде одинакова.
+  static Node* build_balanced(Node** nodes, size_type count) {
+    if (count == 0) return nullptr;
+    size_type red_depth = 0;
+    for (size_type n = count; n > 1; n >>= 1) red_depth++;
+    Node* top = link_balanced(nodes, count, nullptr, 0, red_depth);
+    top->color = BLACK;
+    return top;
+  }
+  static Node* link_balanced(Node** nodes, size_type count, Node* parent,
+                             size_type depth, size_type red_depth) {
+    if (count == 0) return nullptr;
+    size_type middle = count / 2;
+    Node* node = nodes[middle];
+    node->parent = parent;
+    node->color = depth == red_depth ? RED : BLACK;
+    if constexpr (Ranked) node->weight = count;
+    node->left = link_balanced(nodes, middle, node, depth + 1, red_depth);
+    node->right = link_balanced(nodes + middle + 1, count - middle - 1, node,
+                                depth + 1, red_depth);
+    return node;
+  }
 };
 };  // namespace s21
 
@@ -5,19 +5,23 @@
 
 #include "s21_rbtree.h"
 namespace s21 {
-template <typename Key>
-class set : public s21::rbtree<Key> {
+template <typename Key, typename Alloc = node_allocator, bool Ranked = false>
+class set : public s21::rbtree<Key, Key, Alloc, Ranked> {
+ protected:
+  using tree_type = s21::rbtree<Key, Key, Alloc, Ranked>;
+
  public:
-  class SetIterator : public s21::rbtree<Key>::TreeIterator {
+  class SetIterator : public tree_type::TreeIterator {
    public:
-    SetIterator(typename s21::rbtree<Key>::Node *ptr = nullptr)
-        : s21::rbtree<Key>::TreeIterator(ptr) {}
+    SetIterator(typename tree_type::Node *ptr = nullptr)
+        : tree_type::TreeIterator(ptr) {}
+    SetIterator(const typename tree_type::TreeIterator &it)
+        : tree_type::TreeIterator(it) {}
     Key operator*() { return this->node_ptr->key; }
   };
   class ConstSetIterator : public SetIterator {
    public:
-    ConstSetIterator(typename s21::rbtree<Key>::Node *node)
-        : SetIterator(node) {}
+    ConstSetIterator(typename tree_type::Node *node) : SetIterator(node) {}
   };
   using key_type = Key;
   using value_type = Key;
@@ -26,77 +30,112 @@ class set : public s21::rbtree<Key> {
   using size_type = size_t;
   using iterator = SetIterator;
   using const_iterator = ConstSetIterator;
-  set() : rbtree<Key>() {}
+  set() : tree_type() {}
+  explicit set(const Alloc &alloc) : tree_type(alloc) {}
 
   set(std::initializer_list<value_type> const &items) {
     for (value_type item : items) {
       this->insert(item);
     }
   }
-  set(const set &s) {
-    for (const_iterator i = s.begin(); i != s.end(); i++) {
-      this->insert(*i);
-    }
+  // копия повторяет форму дерева s за O(n)
+  set(const set &s) : tree_type(s.get_allocator()) {
+    this->copy_from(s);
   }
-  set(set &&s) : set(s) { s.clear(); }
+  set(set &&s) noexcept : tree_type(std::move(s)) {}
   ~set() = default;
-  set &operator=(set &&s) {
-    if (this != &s) {
-      for (iterator i = s.begin(); i != s.end(); i++) {
-        this->insert(*i);
-      }
-      s.clear();
-    }
+  set &operator=(set &&s) noexcept {
+    tree_type::operator=(std::move(s));
     return *this;
   }
-  set &operator=(set &s) {
-    if (this != &s) {
-      for (iterator i = s.begin(); i != s.end(); i++) {
-        this->insert(*i);
-      }
-    }
+  set &operator=(const set &s) {
+    if (this != &s) this->copy_from(s);
     return *this;
   }
 
   std::pair<iterator, bool> insert(const value_type &value) {
     if (this->contains(value)) return {iterator(nullptr), false};
-    auto treeIter = rbtree<Key, Key>::insert({value, value});
-    return {iterator(rbtree<Key>::getNode(
-                {(*treeIter.first).first, (*treeIter.first).second})),
-            treeIter.second};
+    auto treeIter = tree_type::insert({value, value});
+    return {iterator(treeIter.first), treeIter.second};
   }
 
-  void erase(iterator pos) {
-    if (pos != nullptr)
-      rbtree<Key, Key>::erase(typename rbtree<Key, Key>::TreeIterator(
-          rbtree<Key, Key>::getNode({*pos, *pos})));
+  // вставка как можно ближе перед hint: в конец (hint = end()) и рядом с
+  // подсказкой - без спуска от корня. Итератор на вставленный или уже
+  // имеющийся ключ
+  iterator insert(iterator hint, const value_type &value) {
+    return iterator(tree_type::insert_hint(hint, true, value, value).first);
+  }
+  // узел хранит ключ дважды: одна копия, второй раз ключ перемещается
+  iterator insert(iterator hint, value_type &&value) {
+    return iterator(
+        tree_type::insert_hint(hint, true, value, std::move(value)).first);
+  }
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args &&...args) {
+    return insert(hint, value_type(std::forward<Args>(args)...));
   }
 
-  void swap(set &other) { rbtree<Key>::swap(other); }
+  void erase(iterator pos) { tree_type::erase(pos); }
 
-  void merge(set &other) { rbtree<Key>::merge(other); }
+  void swap(set &other) noexcept { tree_type::swap(other); }
 
-  iterator begin() {
-    if (rbtree<Key>::size() == 0) return end();
-    return iterator(rbtree<Key>::findMin());
-  }
+  // ключи, которые уже есть, остаются в other
+  void merge(set &other) { tree_type::merge_nodes(other, true); }
+
+  iterator begin() { return iterator(tree_type::leftmost()); }
 
   iterator end() { return iterator(nullptr); }
   const_iterator begin() const {
-    if (rbtree<Key>::size() == 0) return end();
-    return const_iterator(rbtree<Key>::findMin());
+    return const_iterator(tree_type::leftmost());
   }
 
   const_iterator end() const { return const_iterator(nullptr); }
-  void clear() { rbtree<Key>::clear(); }
+  void clear() { tree_type::clear(); }
   size_type max_size() {
-    return std::numeric_limits<size_type>::max() / sizeof(set<Key>) / 2;
+    return std::numeric_limits<size_type>::max() / sizeof(set) / 2;
   }
   iterator find(const Key &key) {
-    for (iterator it = begin(); it != end(); it++) {
-      if (*it == key) return it;
-    }
-    return iterator(nullptr);
+    return iterator(tree_type::findNode(key));
+  }
+  iterator lower_bound(const Key &key) {
+    return iterator(tree_type::lowerBoundNode(key));
+  }
+  iterator upper_bound(const Key &key) {
+    return iterator(tree_type::upperBoundNode(key));
+  }
+  std::pair<iterator, iterator> equal_range(const Key &key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  // k-й по порядку ключ за O(log n) при Ranked; rank - из rbtree
+  iterator nth(size_type k) { return iterator(tree_type::nthNode(k)); }
+
+  // ключи сортируются один раз, повторы отбрасываются, новые узлы
+  // встраиваются в дерево пачкой
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    s21::vector<std::pair<Key, Key>> items;
+    items.reserve(sizeof...(Args));
+    (items.push_back({args, args}), ...);
+    return tree_type::template insert_bulk<iterator>(items, true);
+  }
+  template <typename InputIt,
+            typename = std::enable_if_t<is_iterator_of_v<InputIt, Key>>>
+  s21::vector<std::pair<iterator, bool>> insert_many(InputIt first,
+                                                     InputIt last) {
+    s21::vector<std::pair<Key, Key>> items = make_items(first, last);
+    return tree_type::template insert_bulk<iterator>(items, true);
+  }
+
+ protected:
+  template <typename InputIt>
+  static s21::vector<std::pair<Key, Key>> make_items(InputIt first,
+                                                     InputIt last) {
+    s21::vector<std::pair<Key, Key>> items;
+    size_type count = 0;
+    for (InputIt it = first; it != last; ++it) count++;
+    items.reserve(count);
+    for (; first != last; ++first) items.push_back({*first, *first});
+    return items;
   }
 };
 
@@ -0,0 +1,138 @@
+#ifndef CPP_S21_CONTAINERS_SPSC_QUEUE_H
+#define CPP_S21_CONTAINERS_SPSC_QUEUE_H
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Ограниченная очередь для одного производителя и одного потребителя.
+// Без блокировок и ожидания: try_push вызывает только поток-производитель,
+// try_pop - только поток-потребитель. Индексы head/tail растут монотонно и
+// лежат в разных кэш-линиях, каждая сторона держит рядом со своим индексом
+// закэшированную копию чужого, чтобы реже читать общую линию.
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  // емкость округляется вверх до степени двойки
+  explicit spsc_queue(size_type capacity = 1024)
+      : tail_(0), head_cache_(0), head_(0), tail_cache_(0) {
+    capacity_ = 2;
+    while (capacity_ < capacity) capacity_ *= 2;
+    mask_ = capacity_ - 1;
+    data_ = static_cast<value_type*>(::operator new(capacity_ * sizeof(T)));
+  }
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+  ~spsc_queue() {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (; head != tail; head++) data_[head & mask_].~value_type();
+    ::operator delete(data_);
+  }
+
+  // производитель
+  bool try_push(const_reference value) { return emplace(value); }
+  bool try_push(value_type&& value) { return emplace(std::move(value)); }
+
+  // кладет до n элементов из first одной публикацией, возвращает сколько.
+  // Если копия бросает, уже построенные элементы разрушаются и не
+  // публикуются
+  template <typename InputIt>
+  size_type try_push_n(InputIt first, size_type n) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    size_type space = capacity_ - (tail - head_cache_);
+    if (space < n) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      space = capacity_ - (tail - head_cache_);
+    }
+    if (n > space) n = space;
+    size_type i = 0;
+    try {
+      for (; i < n; i++, ++first) {
+        new (data_ + ((tail + i) & mask_)) value_type(*first);
+      }
+    } catch (...) {
+      while (i > 0) data_[(tail + --i) & mask_].~value_type();
+      throw;
+    }
+    tail_.store(tail + n, std::memory_order_release);
+    return n;
+  }
+
+  // потребитель
+  bool try_pop(reference out) { return try_pop_n(&out, 1) == 1; }
+
+  // забирает до n элементов в out одной публикацией, возвращает сколько.
+  // Если присваивание в out бросает, уже забранные элементы публикуются,
+  // а тот, на котором бросило, остается в очереди
+  template <typename OutputIt>
+  size_type try_pop_n(OutputIt out, size_type n) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type ready = tail_cache_ - head;
+    if (ready < n) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+      ready = tail_cache_ - head;
+    }
+    if (n > ready) n = ready;
+    size_type i = 0;
+    try {
+      for (; i < n; i++, ++out) {
+        value_type& el = data_[(head + i) & mask_];
+        *out = std::move(el);
+        el.~value_type();
+      }
+    } catch (...) {
+      head_.store(head + i, std::memory_order_release);
+      throw;
+    }
+    head_.store(head + n, std::memory_order_release);
+    return n;
+  }
+
+  // из других потоков результат приблизительный
+  size_type size() const {
+    // head читается первым: tail, прочитанный позже, не может быть меньше
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+  }
+  bool empty() const { return size() == 0; }
+  size_type capacity() const { return capacity_; }
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  template <typename U>
+  bool emplace(U&& value) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ == capacity_) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ == capacity_) return false;
+    }
+    new (data_ + (tail & mask_)) value_type(std::forward<U>(value));
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // линия производителя
+  alignas(kCacheLine) std::atomic<size_type> tail_;
+  size_type head_cache_;
+  // линия потребителя
+  alignas(kCacheLine) std::atomic<size_type> head_;
+  size_type tail_cache_;
+  // неизменяемые после конструктора поля
+  alignas(kCacheLine) value_type* data_;
+  size_type capacity_;
+  size_type mask_;
+};
+
+}  // namespace s21
+
+#endif
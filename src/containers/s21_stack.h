@@ -2,131 +2,103 @@
 #define CPP_S21_CONTAINERS_STACK_H
 
 #include <iostream>
+#include <utility>
 
-namespace s21 {
+#include "s21_vector.h"
 
-template <typename T>
+namespace s21 {
 
+// Стек - адаптер над Container. По умолчанию это s21::vector: элементы
+// лежат одним блоком, push/pop - сдвиг конца, копия - копия блока. Узловой
+// вариант - stack<T, s21::list<T, Alloc>> с любой политикой узлов.
+// Container нужны back, emplace_back, pop_back, size, empty и swap.
+template <typename T, typename Container = s21::vector<T>>
 class stack {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
 
-  stack() noexcept : top_(nullptr), size_(0) {}
-  stack(std::initializer_list<value_type> const &items) noexcept
-      : top_(nullptr), size_(0) {
-    for (value_type el : items) {
-      push(el);
+  stack() = default;
+  explicit stack(const Container &c) : c_(c) {}
+  stack(std::initializer_list<value_type> const &items) : c_(items) {}
+  stack(const stack &s) = default;
+  stack(stack &&s) = default;
+  ~stack() = default;
+  stack &operator=(const stack &s) = default;
+  stack &operator=(stack &&s) = default;
+
+  // сравнение идет по хранилищу на месте, от дна к вершине, как у
+  // std::stack: ни копий стеков, ни выделений памяти
+  friend bool operator==(const stack &lhs, const stack &rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    auto right = rhs.c_.begin();
+    for (const_reference value : lhs.c_) {
+      if (!(value == *right)) return false;
+      ++right;
     }
+    return true;
   }
-  stack(const stack &s) : top_(nullptr), size_(0) {
-    Node_ *head = s.top_;
-    stack<T> temp;
-    while (head) {
-      temp.push(head->value_);
-      head = head->next_;
-    }
-    for (size_type i = 0; i < s.size_; i++) {
-      push(temp.top());
-      temp.pop();
-    }
+  friend bool operator!=(const stack &lhs, const stack &rhs) {
+    return !(lhs == rhs);
   }
-  stack(stack &&s) : top_(s.top_), size_(s.size_) {
-    s.top_ = nullptr;
-    s.size_ = 0;
+  friend bool operator<(const stack &lhs, const stack &rhs) {
+    return compare(lhs, rhs) < 0;
   }
-  ~stack() {
-    while (top_ != nullptr) {
-      Node_ *tmp = top_;
-      top_ = top_->next_;
-      delete tmp;
-    }
-    size_ = 0;
+  friend bool operator>(const stack &lhs, const stack &rhs) {
+    return rhs < lhs;
   }
-  stack<T> &operator=(stack &&s) {
-    if (this != &s) {
-      while (top_ != nullptr) {
-        pop();
-      }
-
-      top_ = s.top_;
-      size_ = s.size_;
-
-      s.top_ = nullptr;
-      s.size_ = 0;
-    }
-
-    return *this;
+  friend bool operator<=(const stack &lhs, const stack &rhs) {
+    return !(rhs < lhs);
   }
-  bool operator==(const stack<T> &st) const {
-    if (size_ != st.size_) {
-      return false;
-    }
-
-    stack<T> temp1 = *this;
-    stack<T> temp2 = st;
-
-    for (size_t i = 0; i < size_; i++) {
-      if (temp1.top() != temp2.top()) {
-        return false;
-      }
-      temp1.pop();
-      temp2.pop();
-    }
-
-    return true;
+  friend bool operator>=(const stack &lhs, const stack &rhs) {
+    return !(lhs < rhs);
   }
 
   const_reference top() const {
-    if (top_ == nullptr) throw std::out_of_range("stack is empty");
-    return top_->value_;
+    if (c_.empty()) throw std::out_of_range("stack is empty");
+    return c_.back();
   }
 
-  bool empty() const { return size_ == 0; }
-  size_type size() const { return size_; }
+  bool empty() const { return c_.empty(); }
+  size_type size() const { return c_.size(); }
 
-  void push(const_reference value) {
-    Node_ *node = new Node_(value);
-
-    if (top_ == nullptr) {
-      top_ = node;
-    } else {
-      node->next_ = top_;
-      top_ = node;
-    }
-    size_++;
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+  // элемент конструируется прямо в хранилище из аргументов конструктора T
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    c_.emplace_back(std::forward<Args>(args)...);
   }
   void pop() {
-    if (top_ == nullptr) throw std::out_of_range("stack is empty");
-    Node_ *tmp_top = top_;
-    top_ = tmp_top->next_;
-    delete tmp_top;
-    size_--;
-  }
-  void swap(stack &other) {
-    std::swap(top_, other.top_);
-    std::swap(size_, other.size_);
+    if (c_.empty()) throw std::out_of_range("stack is empty");
+    c_.pop_back();
   }
+  void swap(stack &other) noexcept { c_.swap(other.c_); }
 
   template <typename... Args>
   void insert_many_back(Args &&...args) {
-    std::initializer_list<value_type> arguments{args...};
-    for (value_type elem : arguments) {
-      push(elem);
-    }
+    (emplace(std::forward<Args>(args)), ...);
   }
 
- private:
-  typedef struct Node_ {
-    value_type value_;
-    Node_ *next_;
-    Node_(value_type value) : value_(value), next_(nullptr) {}
-  } Node_;
+ protected:
+  Container c_;
 
-  Node_ *top_;
-  size_type size_;
+ private:
+  // лексикографически: -1, если lhs меньше, 0 - равны, 1 - больше;
+  // для порядка элементам нужен только operator<
+  static int compare(const stack &lhs, const stack &rhs) {
+    auto left = lhs.c_.begin(), left_end = lhs.c_.end();
+    auto right = rhs.c_.begin(), right_end = rhs.c_.end();
+    for (; left != left_end && right != right_end; ++left, ++right) {
+      if (*left < *right) return -1;
+      if (*right < *left) return 1;
+    }
+    if (left != left_end) return 1;
+    return right != right_end ? -1 : 0;
+  }
 };
 
 }  // namespace s21
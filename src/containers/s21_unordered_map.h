@@ -0,0 +1,371 @@
+#ifndef CPP_S21_CONTAINERS_UNORDERED_MAP_H
+#define CPP_S21_CONTAINERS_UNORDERED_MAP_H
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Хеш-таблица с открытой адресацией (Robin Hood): элементы лежат в одном
+// массиве, при вставке "бедный" элемент (дальше от своей позиции) вытесняет
+// "богатого", удаление сдвигает хвост цепочки назад без надгробий.
+// Любая вставка или удаление делает итераторы недействительными.
+template <typename Key, typename T, typename Hash = std::hash<Key>>
+class unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = size_t;
+
+ private:
+  using slot_type = std::pair<key_type, mapped_type>;
+  // dist_[i]: 0 - ячейка пуста, иначе расстояние от идеальной позиции + 1.
+  // 16 бит: даже ключи с одинаковым хешем выдерживают тысячи вставок
+  using dist_type = uint16_t;
+  static constexpr dist_type kMaxDist = std::numeric_limits<dist_type>::max();
+  static constexpr size_type kMinCapacity = 16;
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+ public:
+  class HashIterator {
+    friend class unordered_map;
+
+   public:
+    HashIterator(slot_type* slot = nullptr, dist_type* dist = nullptr,
+                 dist_type* dist_end = nullptr)
+        : slot_(slot), dist_(dist), dist_end_(dist_end) {
+      skip_empty();
+    }
+    // ключ только для чтения, значение можно менять через second
+    std::pair<const Key&, T&> operator*() const {
+      return {slot_->first, slot_->second};
+    }
+    T& getValue() { return slot_->second; }
+
+    HashIterator& operator++() {
+      ++slot_;
+      ++dist_;
+      skip_empty();
+      return *this;
+    }
+    HashIterator operator++(int) {
+      HashIterator copy{*this};
+      ++(*this);
+      return copy;
+    }
+    bool operator!=(const HashIterator& other) const {
+      return slot_ != other.slot_;
+    }
+    bool operator==(const HashIterator& other) const {
+      return slot_ == other.slot_;
+    }
+
+   protected:
+    void skip_empty() {
+      while (dist_ != dist_end_ && *dist_ == 0) {
+        ++slot_;
+        ++dist_;
+      }
+    }
+    slot_type* slot_;
+    dist_type* dist_;
+    dist_type* dist_end_;
+  };
+  using iterator = HashIterator;
+  using const_iterator = HashIterator;
+
+  unordered_map()
+      : slots_(nullptr), dist_(nullptr), capacity_(0), size_(0), shift_(64) {}
+  unordered_map(std::initializer_list<value_type> const& items)
+      : unordered_map() {
+    reserve(items.size());
+    for (const value_type& el : items) insert(el);
+  }
+  unordered_map(const unordered_map& m) : unordered_map() {
+    hasher_ = m.hasher_;
+    reserve(m.size_);
+    for (size_type i = 0; i < m.capacity_; i++)
+      if (m.dist_[i]) insert_slot(slot_type(m.slots_[i]));
+  }
+  unordered_map(unordered_map&& m) noexcept : unordered_map() { swap(m); }
+  ~unordered_map() {
+    clear();
+    deallocate();
+  }
+  unordered_map& operator=(unordered_map&& m) noexcept {
+    if (this != &m) {
+      clear();
+      swap(m);
+    }
+    return *this;
+  }
+  unordered_map& operator=(const unordered_map& m) {
+    if (this != &m) {
+      unordered_map copy(m);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  iterator begin() { return make_iterator(0); }
+  iterator end() { return make_iterator(capacity_); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(slot_type) / 2;
+  }
+  size_type bucket_count() const { return capacity_; }
+  double load_factor() const {
+    return capacity_ ? static_cast<double>(size_) / capacity_ : 0.0;
+  }
+
+  // емкость под count элементов без перестроения таблицы
+  void reserve(size_type count) {
+    size_type needed = kMinCapacity;
+    while (needed * 7 < count * 8) needed *= 2;
+    if (needed > capacity_) rehash(needed);
+  }
+
+  void clear() {
+    for (size_type i = 0; i < capacity_; i++) {
+      if (dist_[i]) {
+        slots_[i].~slot_type();
+        dist_[i] = 0;
+      }
+    }
+    size_ = 0;
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return insert(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(const Key& key, const T& obj) {
+    size_type index = find_index(key);
+    if (index != npos) return {make_iterator(index), false};
+    return {make_iterator(insert_slot(slot_type(key, obj))), true};
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    size_type index = find_index(key);
+    if (index != npos) {
+      slots_[index].second = obj;
+      return {make_iterator(index), false};
+    }
+    return {make_iterator(insert_slot(slot_type(key, obj))), true};
+  }
+
+  T& at(const Key& key) {
+    size_type index = find_index(key);
+    if (index == npos) {
+      throw std::out_of_range("Out of range");
+    }
+    return slots_[index].second;
+  }
+  T& operator[](const Key& key) {
+    size_type index = find_index(key);
+    if (index == npos) index = insert_slot(slot_type(key, T()));
+    return slots_[index].second;
+  }
+
+  iterator find(const Key& key) {
+    size_type index = find_index(key);
+    return index == npos ? end() : make_iterator(index);
+  }
+  bool contains(const Key& key) const { return find_index(key) != npos; }
+
+  void erase(iterator pos) {
+    if (pos != end()) erase_index(pos.slot_ - slots_);
+  }
+  size_type erase(const Key& key) {
+    size_type index = find_index(key);
+    if (index == npos) return 0;
+    erase_index(index);
+    return 1;
+  }
+
+  void swap(unordered_map& other) noexcept {
+    std::swap(slots_, other.slots_);
+    std::swap(dist_, other.dist_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(shift_, other.shift_);
+    std::swap(hasher_, other.hasher_);
+  }
+
+  // переносит элементы с новыми ключами, совпадающие остаются в other
+  void merge(unordered_map& other) {
+    if (this == &other) return;
+    size_type i = 0;
+    while (i < other.capacity_) {
+      if (other.dist_[i] && !contains(other.slots_[i].first)) {
+        insert_slot(std::move(other.slots_[i]));
+        other.erase_index(i);  // на место i мог сдвинуться следующий элемент
+      } else {
+        i++;
+      }
+    }
+  }
+
+  // сначала вставляется вся пачка, потом ищутся итераторы: следующая
+  // вставка может вытеснить уже вставленный элемент в другую ячейку
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<slot_type> items;
+    items.reserve(sizeof...(Args));
+    (items.push_back(slot_type(std::forward<Args>(args))), ...);
+    reserve(size_ + items.size());
+    s21::vector<bool> inserted;
+    inserted.reserve(items.size());
+    for (size_type i = 0; i < items.size(); i++) {
+      inserted.push_back(find_index(items[i].first) == npos);
+      if (!inserted[i]) continue;
+      // ключ остается в items для поиска итератора, значение переезжает
+      insert_slot(slot_type(items[i].first, std::move(items[i].second)));
+    }
+    s21::vector<std::pair<iterator, bool>> results;
+    results.reserve(items.size());
+    for (size_type i = 0; i < items.size(); i++) {
+      results.push_back(
+          {make_iterator(find_index(items[i].first)), inserted[i]});
+    }
+    return results;
+  }
+
+ private:
+  iterator make_iterator(size_type index) {
+    return iterator(slots_ + index, dist_ + index, dist_ + capacity_);
+  }
+
+  size_type home(const Key& key) const {
+    // перемешивание Фибоначчи: старшие биты произведения как индекс
+    uint64_t h = static_cast<uint64_t>(hasher_(key));
+    return static_cast<size_type>((h * 0x9E3779B97F4A7C15ull) >> shift_);
+  }
+
+  size_type find_index(const Key& key) const {
+    if (size_ == 0) return npos;
+    size_type mask = capacity_ - 1, index = home(key);
+    for (dist_type d = 1;; d++, index = (index + 1) & mask) {
+      // пустая ячейка или элемент ближе к своему дому - ключа нет
+      if (dist_[index] < d) return npos;
+      if (dist_[index] == d && slots_[index].first == key) return index;
+    }
+  }
+
+  // вставка ключа, которого точно нет в таблице; возвращает его индекс.
+  // Если цепочка переполнила бы dist_type, таблица растет, но только пока
+  // она не стала редкой: дальше рост не поможет, ключи совпадают после
+  // перемешивания, и вставка бросает std::length_error, не трогая таблицу.
+  // При перестройке (rehashing) элементы уже были в таблице, там только рост
+  size_type insert_slot(slot_type&& value, bool rehashing = false) {
+    if ((size_ + 1) * 8 > capacity_ * 7)
+      rehash(capacity_ ? capacity_ * 2 : kMinCapacity);
+    while (probe_overflows(value.first)) {
+      if (!rehashing && size_ * 8 < capacity_) {
+        throw std::length_error("s21::unordered_map: too many equal hashes");
+      }
+      rehash(capacity_ * 2);
+    }
+    size_type mask = capacity_ - 1, index = home(value.first),
+              result = npos;
+    dist_type d = 1;
+    while (dist_[index] != 0) {
+      if (dist_[index] < d) {  // вытесняем более "богатый" элемент
+        std::swap(value, slots_[index]);
+        std::swap(d, dist_[index]);
+        if (result == npos) result = index;
+      }
+      index = (index + 1) & mask;
+      ++d;
+    }
+    new (slots_ + index) slot_type(std::move(value));
+    dist_[index] = d;
+    size_++;
+    return result == npos ? index : result;
+  }
+
+  // вставка key без изменений таблицы: дойдет ли переносимое расстояние
+  // до kMaxDist. Повторяет вытеснения insert_slot
+  bool probe_overflows(const Key& key) const {
+    size_type mask = capacity_ - 1, index = home(key);
+    for (dist_type d = 1; dist_[index] != 0; index = (index + 1) & mask) {
+      if (dist_[index] < d) d = dist_[index];
+      if (++d == kMaxDist) return true;
+    }
+    return false;
+  }
+
+  void erase_index(size_type index) {
+    size_type mask = capacity_ - 1, next = (index + 1) & mask;
+    slots_[index].~slot_type();
+    // сдвигаем назад хвост цепочки, пока элементы не на своих местах
+    while (dist_[next] > 1) {
+      new (slots_ + index) slot_type(std::move(slots_[next]));
+      slots_[next].~slot_type();
+      dist_[index] = dist_[next] - 1;
+      index = next;
+      next = (next + 1) & mask;
+    }
+    dist_[index] = 0;
+    size_--;
+  }
+
+  void rehash(size_type new_capacity) {
+    slot_type* old_slots = slots_;
+    dist_type* old_dist = dist_;
+    size_type old_capacity = capacity_;
+
+    // оба массива выделяются до изменения полей: если второе выделение
+    // бросит, таблица остается прежней
+    slot_type* new_slots = static_cast<slot_type*>(
+        ::operator new(new_capacity * sizeof(slot_type)));
+    dist_type* new_dist;
+    try {
+      new_dist = new dist_type[new_capacity]();
+    } catch (...) {
+      ::operator delete(new_slots);
+      throw;
+    }
+    slots_ = new_slots;
+    dist_ = new_dist;
+    capacity_ = new_capacity;
+    size_ = 0;
+    shift_ = 64;
+    for (size_type c = new_capacity; c > 1; c >>= 1) shift_--;
+
+    for (size_type i = 0; i < old_capacity; i++) {
+      if (old_dist[i]) {
+        insert_slot(std::move(old_slots[i]), true);
+        old_slots[i].~slot_type();
+      }
+    }
+    ::operator delete(old_slots);
+    delete[] old_dist;
+  }
+
+  void deallocate() {
+    ::operator delete(slots_);
+    delete[] dist_;
+    slots_ = nullptr;
+    dist_ = nullptr;
+    capacity_ = 0;
+  }
+
+  slot_type* slots_;
+  dist_type* dist_;
+  size_type capacity_;
+  size_type size_;
+  unsigned shift_;  // 64 - log2(capacity_)
+  Hash hasher_;
+};
+}  // namespace s21
+
+#endif
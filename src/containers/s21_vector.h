@@ -1,8 +1,17 @@
 #ifndef CPP_S21_CONTAINERS_VECTOR_H
 #define CPP_S21_CONTAINERS_VECTOR_H
 
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_iterator_traits.h"
 
 namespace s21 {
 template <typename T>
@@ -71,30 +80,30 @@ class vector {
   using const_iterator = ConstVectorIterator;
 
   vector() : data_(nullptr), size_(0), capacity_(0) {}
-  vector(size_type n) : data_(new value_type[n]()), size_(0), capacity_(n) {}
-  vector(std::initializer_list<value_type> const& items)
-      : size_(items.size()), capacity_(items.size()) {
-    this->data_ = new value_type[this->size_];
-    std::copy(items.begin(), items.end(), this->data_);
+  vector(size_type n) : vector() { this->reserve(n); }
+  vector(std::initializer_list<value_type> const& items) : vector() {
+    this->reserve(items.size());
+    for (const_reference el : items) {
+      new (this->data_ + this->size_) value_type(el);
+      this->size_++;
+    }
   }
   vector(const vector& v) : vector() {
-    for (const_iterator el = v.begin(); el != v.end(); el++) {
-      this->push_back(*el);
+    this->reserve(v.size_);
+    for (size_type i = 0; i < v.size_; i++) {
+      new (this->data_ + this->size_) value_type(v.data_[i]);
+      this->size_++;
     }
   }
-  vector(vector&& v) : vector(v) { v.clear(); }
-  ~vector() { this->clear(); }
-  vector& operator=(vector&& v) {
+  vector(vector&& v) noexcept : vector() { this->swap(v); }
+  ~vector() {
+    destroy(this->data_, this->data_ + this->size_);
+    deallocate(this->data_);
+  }
+  vector& operator=(vector&& v) noexcept {
     if (this != &v) {
-      delete[] this->data_;
-
-      this->data_ = v.data_;
-      this->size_ = v.size_;
-      this->capacity_ = v.capacity_;
-
-      v.data_ = nullptr;
-      v.size_ = 0;
-      v.capacity_ = 0;
+      vector moved(std::move(v));
+      this->swap(moved);
     }
 
     return *this;
@@ -102,13 +111,8 @@ class vector {
 
   vector& operator=(const vector& v) {
     if (this != &v) {
-      delete[] this->data_;
-      this->size_ = 0;
-      this->capacity_ = 0;
-
-      for (iterator it = v.begin(); it != v.end(); it++) {
-        this->push_back(*it);
-      }
+      vector copy(v);
+      this->swap(copy);
     }
 
     return *this;
@@ -121,8 +125,8 @@ class vector {
     return this->data_[pos];
   }
   reference operator[](size_type pos) { return *(this->data_ + pos); }
-  const_reference front() { return this->data_[0]; }
-  const_reference back() { return this->data_[this->size_ - 1]; }
+  const_reference front() const { return this->data_[0]; }
+  const_reference back() const { return this->data_[this->size_ - 1]; }
   T* data() { return this->data_; }
 
   iterator begin() { return iterator(this->data_); }
@@ -143,128 +147,248 @@ class vector {
     }
 
     if (size > this->capacity()) {
-      iterator_ptr new_data = new value_type[size];
-      std::copy(this->data_, this->data_ + this->size_, new_data);
-
-      delete[] this->data_;
-      this->data_ = new_data;
-      this->capacity_ = size;
+      this->reallocate(size);
     }
   }
   size_type capacity() const { return this->capacity_; }
   void shrink_to_fit() {
     if (this->size_ < this->capacity_) {
-      iterator_ptr temp_vector = new value_type[this->size_];
-      std::copy(this->data_, this->data_ + this->size_, temp_vector);
-
-      delete[] this->data_;
-
-      this->data_ = temp_vector;
-      this->capacity_ = this->size_;
+      this->reallocate(this->size_);
     }
   }
 
+  // буфер освобождается; capacity() не меняется, и блок под нее заново
+  // выделяется при следующей вставке
   void clear() {
-    if (this->data_ != nullptr) {
-      delete[] this->data_;
-      this->data_ = nullptr;
-      this->size_ = 0;
-    }
+    destroy(this->data_, this->data_ + this->size_);
+    deallocate(this->data_);
+    this->data_ = nullptr;
+    this->size_ = 0;
   }
   iterator insert(iterator pos, const_reference value) {
-    iterator_ptr temp_vector = new value_type[this->size_ + 1];
-
+    return this->emplace(pos, value);
+  }
+  iterator insert(iterator pos, value_type&& value) {
+    return this->emplace(pos, std::move(value));
+  }
+  // элементы из [first, last) вставляются перед pos; итераторы прямого
+  // прохода и не должны указывать внутрь самого вектора
+  template <typename InputIt>
+  iterator insert(iterator pos, InputIt first, InputIt last) {
     size_type index = pos - this->begin();
-
-    for (size_type i = 0; i < index; i++) {
-      temp_vector[i] = this->data_[i];
+    size_type count = 0;
+    for (InputIt it = first; it != last; ++it) count++;
+    if (count == 0) return pos;
+
+    this->open_gap(index, count);
+    size_type done = 0;
+    try {
+      for (; done < count; ++done, ++first) {
+        new (this->data_ + index + done) value_type(*first);
+      }
+    } catch (...) {
+      destroy(this->data_ + index, this->data_ + index + done);
+      this->shift(index + count, index, this->size_ - index);
+      throw;
     }
+    this->size_ += count;
 
-    temp_vector[index] = value;
-
-    for (size_type i = index; i < this->size_; i++) {
-      temp_vector[i + 1] = this->data_[i];
+    return this->begin() + index;
+  }
+  // элемент создается прямо в своей ячейке из аргументов конструктора T
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args) {
+    size_type index = pos - this->begin();
+    if (index == this->size_) {
+      this->emplace_back(std::forward<Args>(args)...);
+      return this->begin() + index;
     }
 
-    delete[] this->data_;
-    this->data_ = temp_vector;
+    // аргументы могут ссылаться на элементы, которые сдвинутся
+    value_type temp(std::forward<Args>(args)...);
+    this->open_gap(index, 1);
+    new (this->data_ + index) value_type(std::move(temp));
     this->size_++;
 
     return this->begin() + index;
   }
-  void erase(iterator pos) {
-    iterator_ptr temp_vector = new value_type[this->size_ - 1];
+  iterator erase(iterator pos) { return this->erase(pos, pos + 1); }
+  iterator erase(iterator first, iterator last) {
+    size_type index = first - this->begin();
+    size_type count = last - first;
+    destroy(first.iterator_ptr_, last.iterator_ptr_);
+    this->shift(index + count, index, this->size_ - index - count);
+    this->size_ -= count;
 
-    size_type index = 0;
-
-    for (size_type i = 0; i < this->size_; i++) {
-      if (pos - this->begin() == i) {
-        continue;
-      }
-      temp_vector[index++] = this->data_[i];
-    }
-
-    delete[] this->data_;
-    this->data_ = temp_vector;
-    this->size_--;
+    return this->begin() + index;
   }
-  void push_back(const_reference value) {
+  void push_back(const_reference value) { this->emplace_back(value); }
+  void push_back(value_type&& value) { this->emplace_back(std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    this->restore_storage();
     if (this->size_ == this->capacity_) {
-      size_type new_capacity = (this->capacity_ == 0) ? 1 : this->capacity_ * 2;
-      this->reserve(new_capacity);
+      // аргументы могут ссылаться на элементы, которые переедут при росте
+      value_type temp(std::forward<Args>(args)...);
+      this->reallocate(this->next_capacity());
+      new (this->data_ + this->size_) value_type(std::move(temp));
+    } else {
+      new (this->data_ + this->size_) value_type(std::forward<Args>(args)...);
     }
-    this->data_[this->size_++] = value;
+    return this->data_[this->size_++];
   }
   void pop_back() {
     if (this->size_ > 0) {
       this->size_--;
+      this->data_[this->size_].~value_type();
     }
   }
-  void swap(vector& other) {
+  void swap(vector& other) noexcept {
     std::swap(this->data_, other.data_);
     std::swap(this->size_, other.size_);
     std::swap(this->capacity_, other.capacity_);
   }
 
+  // место под все аргументы открывается одним сдвигом (или одним
+  // перевыделением), затем элементы строятся прямо в нем
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args&&... args) {
-    // Создаю временный вектор для новых элементов
-    s21::vector<value_type> arguments{args...};
+    constexpr size_type count = sizeof...(Args);
+    size_type index = pos - this->begin();
+    if (count == 0) return this->begin() + index;
+    if ((this->points_inside(std::addressof(args)) || ...)) {
+      // аргумент лежит в самом векторе и переедет при сдвиге
+      vector items;
+      items.reserve(count);
+      (items.emplace_back(std::forward<Args>(args)), ...);
+      return this->insert(this->begin() + index,
+                          std::make_move_iterator(items.data_),
+                          std::make_move_iterator(items.data_ + count));
+    }
+
+    this->open_gap(index, count);
+    size_type done = 0;
+    try {
+      ((new (this->data_ + index + done) value_type(std::forward<Args>(args)),
+        ++done),
+       ...);
+    } catch (...) {
+      destroy(this->data_ + index, this->data_ + index + done);
+      this->shift(index + count, index, this->size_ - index);
+      throw;
+    }
+    this->size_ += count;
 
-    size_type new_size = this->size_ + arguments.size();
-    iterator_ptr temp_vector = new value_type[new_size];
+    return this->begin() + index;
+  }
+  // вариант для пачки, размер которой известен только во время выполнения
+  template <typename InputIt,
+            typename = std::enable_if_t<is_iterator_of_v<InputIt, T>>>
+  iterator insert_many(const_iterator pos, InputIt first, InputIt last) {
+    return this->insert(pos, first, last);
+  }
 
-    size_type pos_index = pos - this->begin();
+  template <typename... Args>
+  void insert_many_back(Args&&... args) {
+    this->insert_many(this->end(), std::forward<Args>(args)...);
+  }
 
-    // Копирую элементы до позиции вставки
-    for (size_type i = 0; i < pos_index; ++i) {
-      temp_vector[i] = this->data_[i];
+ private:
+  static iterator_ptr allocate(size_type count) {
+    if (count == 0) return nullptr;
+    return static_cast<iterator_ptr>(::operator new(count * sizeof(T)));
+  }
+  static void deallocate(iterator_ptr data) { ::operator delete(data); }
+  static void destroy(iterator_ptr first, iterator_ptr last) {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (; first != last; ++first) first->~value_type();
     }
+  }
 
-    // Вставляю новые элементы
-    for (size_type i = 0; i < arguments.size(); ++i) {
-      temp_vector[pos_index + i] = arguments[i];
+  // переносит n элементов из [from, from + n) в [to, to + n) внутри блока:
+  // ячейки назначения вне источника должны быть пустыми, источник после
+  // переноса пуст; тривиально копируемые типы сдвигаются одним memmove
+  void shift(size_type from, size_type to, size_type n) {
+    if (n == 0 || from == to) return;
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      std::memmove(this->data_ + to, this->data_ + from, n * sizeof(T));
+    } else if (to > from) {
+      for (size_type i = n; i > 0; i--) {
+        new (this->data_ + to + i - 1)
+            value_type(std::move(this->data_[from + i - 1]));
+        this->data_[from + i - 1].~value_type();
+      }
+    } else {
+      for (size_type i = 0; i < n; i++) {
+        new (this->data_ + to + i) value_type(std::move(this->data_[from + i]));
+        this->data_[from + i].~value_type();
+      }
     }
+  }
 
-    // Копирую оставшиеся элементы после позиции вставки
-    for (size_type i = pos_index; i < this->size_; ++i) {
-      temp_vector[i + arguments.size()] = this->data_[i];
+  // освобождает count пустых ячеек перед элементом index, при нехватке
+  // емкости - за одно перевыделение
+  void open_gap(size_type index, size_type count) {
+    this->restore_storage();
+    if (this->size_ + count > this->capacity_) {
+      size_type new_capacity = this->next_capacity();
+      if (new_capacity < this->size_ + count) {
+        new_capacity = this->size_ + count;
+      }
+      this->reallocate(new_capacity, index, count);
+    } else {
+      this->shift(index, index + count, this->size_ - index);
     }
+  }
+  bool points_inside(const void* ptr) const {
+    std::less<const void*> less;
+    return !less(ptr, this->data_) && less(ptr, this->data_ + this->size_);
+  }
 
-    delete[] this->data_;
-    this->data_ = temp_vector;
-    this->size_ = new_size;
-    this->reserve(this->size_);
+  // после clear буфера нет, но емкость сохранена
+  void restore_storage() {
+    if (this->data_ == nullptr && this->capacity_ != 0) {
+      this->data_ = allocate(this->capacity_);
+    }
+  }
 
-    return this->begin() + pos_index;
+  size_type next_capacity() const {
+    return this->capacity_ == 0 ? 1 : this->capacity_ * 2;
   }
 
-  template <typename... Args>
-  void insert_many_back(Args&&... args) {
-    this->insert_many(this->end(), args...);
+  // переносит элементы в новый блок на new_capacity ячеек, оставляя перед
+  // элементом index пропуск из gap неинициализированных ячеек;
+  // тривиально копируемые типы переносятся memcpy, остальные - перемещением
+  void reallocate(size_type new_capacity, size_type index = 0,
+                  size_type gap = 0) {
+    iterator_ptr new_data = allocate(new_capacity);
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      if (this->size_ != 0) {
+        std::memcpy(new_data, this->data_, index * sizeof(T));
+        std::memcpy(new_data + index + gap, this->data_ + index,
+                    (this->size_ - index) * sizeof(T));
+      }
+    } else {
+      size_type done = 0;
+      try {
+        for (; done < this->size_; done++) {
+          new (new_data + (done < index ? done : done + gap))
+              value_type(std::move_if_noexcept(this->data_[done]));
+        }
+      } catch (...) {
+        for (size_type i = 0; i < done; i++) {
+          new_data[i < index ? i : i + gap].~value_type();
+        }
+        deallocate(new_data);
+        throw;
+      }
+      destroy(this->data_, this->data_ + this->size_);
+    }
+    deallocate(this->data_);
+    this->data_ = new_data;
+    this->capacity_ = new_capacity;
   }
 
- private:
   iterator_ptr data_;
   size_type size_;
   size_type capacity_;
@@ -0,0 +1,199 @@
+#ifndef CPP_S21_CONTAINERS_COUNTED_MULTISET_H
+#define CPP_S21_CONTAINERS_COUNTED_MULTISET_H
+
+#include <iostream>
+
+#include "../containers/s21_rbtree.h"
+
+namespace s21 {
+// Компактный multiset: один узел на различный ключ, в значении узла -
+// число копий. Вставка уже имеющегося ключа не выделяет память, count -
+// O(log n), а итератор проходит каждую копию, как у обычного multiset.
+// Подходит, когда различных ключей мало, а повторов много; копии равных
+// ключей неотличимы, поэтому порядок их вставки не хранится.
+template <typename Key, typename Alloc = node_allocator>
+class counted_multiset : protected s21::rbtree<Key, size_t, Alloc> {
+  using tree_type = s21::rbtree<Key, size_t, Alloc>;
+  using Node = typename tree_type::Node;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = size_t;
+
+  // позиция - узел и номер копии в нем
+  class CountedIterator : public tree_type::TreeIterator {
+    friend class counted_multiset;
+
+   public:
+    CountedIterator(Node* ptr = nullptr, size_type copy = 0)
+        : tree_type::TreeIterator(ptr), copy_(copy) {}
+    CountedIterator(const typename tree_type::TreeIterator& it)
+        : tree_type::TreeIterator(it), copy_(0) {}
+    Key operator*() { return this->node_ptr->key; }
+    CountedIterator& operator++() {
+      if (++copy_ < this->node_ptr->value) return *this;
+      copy_ = 0;
+      tree_type::TreeIterator::operator++();
+      return *this;
+    }
+    CountedIterator operator++(int) {
+      CountedIterator copy{*this};
+      ++(*this);
+      return copy;
+    }
+    CountedIterator& operator--() {
+      if (copy_ > 0) {
+        --copy_;
+      } else {
+        tree_type::TreeIterator::operator--();
+        if (this->node_ptr) copy_ = this->node_ptr->value - 1;
+      }
+      return *this;
+    }
+    CountedIterator operator--(int) {
+      CountedIterator copy{*this};
+      --(*this);
+      return copy;
+    }
+    bool operator==(const CountedIterator& other) const {
+      return this->node_ptr == other.node_ptr && copy_ == other.copy_;
+    }
+    bool operator!=(const CountedIterator& other) const {
+      return !(*this == other);
+    }
+    // сколько всего копий ключа в узле, на который указывает итератор
+    size_type multiplicity() const { return this->node_ptr->value; }
+
+   private:
+    size_type copy_;
+  };
+  using iterator = CountedIterator;
+  using const_iterator = CountedIterator;
+
+  counted_multiset() : tree_type(), size_(0) {}
+  explicit counted_multiset(const Alloc& alloc) : tree_type(alloc), size_(0) {}
+  counted_multiset(std::initializer_list<value_type> const& items)
+      : counted_multiset() {
+    for (const_reference item : items) insert(item);
+  }
+  counted_multiset(const counted_multiset& ms)
+      : counted_multiset(ms.get_allocator()) {
+    add_counts(ms);
+  }
+  counted_multiset(counted_multiset&& ms) noexcept : counted_multiset() {
+    swap(ms);
+  }
+  ~counted_multiset() = default;
+
+  counted_multiset& operator=(counted_multiset&& ms) noexcept {
+    if (this != &ms) {
+      clear();
+      swap(ms);
+    }
+    return *this;
+  }
+  counted_multiset& operator=(const counted_multiset& ms) {
+    if (this != &ms) {
+      clear();
+      add_counts(ms);
+    }
+    return *this;
+  }
+
+  iterator begin() const { return iterator(tree_type::leftmost()); }
+  iterator end() const { return iterator(nullptr); }
+
+  bool empty() const { return size_ == 0; }
+  // число всех копий; различных ключей - distinct_size()
+  size_type size() const { return size_; }
+  size_type distinct_size() const { return tree_type::size(); }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(Node) / 2;
+  }
+  using tree_type::get_allocator;
+
+  void clear() {
+    tree_type::clear();
+    size_ = 0;
+  }
+  // если ключ уже есть, растет только счетчик узла
+  iterator insert(const value_type& value) { return insert(value, 1); }
+  // copies == 0 ничего не вставляет: первая копия value или end()
+  iterator insert(const value_type& value, size_type copies) {
+    Node* node = tree_type::findNode(value);
+    if (copies == 0) return iterator(node);
+    if (node == nullptr) {
+      iterator it(tree_type::insert({value, copies}).first);
+      size_ += copies;
+      return iterator(it.node_ptr, copies - 1);
+    }
+    node->value += copies;
+    size_ += copies;
+    return iterator(node, node->value - 1);
+  }
+  // удаляет одну копию; узел уходит вместе с последней
+  void erase(iterator pos) {
+    if (pos.node_ptr == nullptr) return;
+    if (pos.node_ptr->value > 1) {
+      pos.node_ptr->value--;
+    } else {
+      tree_type::erase(pos);
+    }
+    size_--;
+  }
+  void swap(counted_multiset& other) noexcept {
+    tree_type::swap(other);
+    std::swap(size_, other.size_);
+  }
+  // счетчики other прибавляются к своим, новые узлы - только для новых
+  // ключей
+  void merge(counted_multiset& other) {
+    if (this == &other) return;
+    add_counts(other);
+    other.clear();
+  }
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> results;
+    results.reserve(sizeof...(Args));
+    (results.push_back({insert(std::forward<Args>(args)), true}), ...);
+    return results;
+  }
+
+  size_type count(const Key& key) const {
+    Node* node = tree_type::findNode(key);
+    return node ? node->value : 0;
+  }
+  bool contains(const Key& key) const { return tree_type::contains(key); }
+  iterator find(const Key& key) const {
+    return iterator(tree_type::findNode(key));
+  }
+  iterator lower_bound(const Key& key) const {
+    return iterator(tree_type::lowerBoundNode(key));
+  }
+  iterator upper_bound(const Key& key) const {
+    return iterator(tree_type::upperBoundNode(key));
+  }
+  std::pair<iterator, iterator> equal_range(const Key& key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+ private:
+  void add_counts(const counted_multiset& other) {
+    for (iterator it = other.begin(); it != other.end();) {
+      size_type copies = it.multiplicity();
+      insert(*it, copies);
+      it = iterator(it.node_ptr, copies - 1);
+      ++it;
+    }
+  }
+
+  size_type size_;  // число копий во всех узлах
+};
+}  // namespace s21
+
+#endif
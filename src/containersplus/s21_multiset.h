@@ -6,121 +6,81 @@
 #include "../containers/s21_set.h"
 
 namespace s21 {
-template <typename Key>
-class multiset : public s21::set<Key> {
+template <typename Key, typename Alloc = node_allocator, bool Ranked = false>
+class multiset : public s21::set<Key, Alloc, Ranked> {
+  using tree_type = s21::rbtree<Key, Key, Alloc, Ranked>;
   using key_type = Key;
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename set<Key>::SetIterator;
-  using const_iterator = typename set<Key>::ConstSetIterator;
+  using iterator = typename set<Key, Alloc, Ranked>::SetIterator;
+  using const_iterator = typename set<Key, Alloc, Ranked>::ConstSetIterator;
   using size_type = size_t;
 
  public:
-  multiset() : set<Key>() {}
+  multiset() : set<Key, Alloc, Ranked>() {}
+  explicit multiset(const Alloc& alloc) : set<Key, Alloc, Ranked>(alloc) {}
   multiset(std::initializer_list<value_type> const& items) {
     for (value_type item : items) {
       this->insert(item);
     }
   }
-  multiset(const multiset& ms) : set<Key>() {
-    for (const_iterator i = ms.begin(); i != ms.end(); i++) {
-      this->insert(*i);
-    }
-  }
-  multiset(multiset&& ms) : multiset(ms) { ms.clear(); }
+  multiset(const multiset& ms) : set<Key, Alloc, Ranked>(ms) {}
+  multiset(multiset&& ms) noexcept : set<Key, Alloc, Ranked>(std::move(ms)) {}
   ~multiset() = default;
 
-  multiset& operator=(multiset&& ms) {
-    if (this != &ms) {
-      this->clear();
-      for (iterator it = ms.begin(); it != ms.end(); it++) {
-        this->insert(*it);
-      }
-      ms.clear();
-    }
+  multiset& operator=(multiset&& ms) noexcept {
+    tree_type::operator=(std::move(ms));
     return *this;
   }
 
-  multiset& operator=(multiset& ms) {
-    if (this != &ms) {
-      this->clear();
-      for (iterator it = ms.begin(); it != ms.end(); it++) {
-        this->insert(*it);
-      }
-    }
+  multiset& operator=(const multiset& ms) {
+    if (this != &ms) this->copy_from(ms);
     return *this;
   }
 
   iterator insert(const value_type& value) {
-    auto treeIter = rbtree<Key, Key>::insert({value, value});
-    return iterator(rbtree<Key>::getNode(
-        {(*treeIter.first).first, (*treeIter.first).second}));
+    return iterator(tree_type::insert({value, value}).first);
   }
-
-  void swap(multiset& other) { rbtree<Key>::swap(other); }
-  void merge(multiset& other) { rbtree<Key>::merge(other); }
-
-  size_type count(const Key& key) {
-    size_type counter = 0;
-    for (iterator it = this->begin(); it != this->end(); it++) {
-      if (*it == key) {
-        counter++;
-      }
-    }
-    return counter;
+  // копия встает как можно ближе перед hint, см. set::insert(hint, value)
+  iterator insert(iterator hint, const value_type& value) {
+    return iterator(tree_type::insert_hint(hint, false, value, value).first);
   }
-
-  iterator find(const Key& key) {
-    for (iterator it = this->begin(); it != this->end(); it++) {
-      if (*it == key) {
-        return it;
-      }
-    }
-    return iterator(nullptr);
+  iterator insert(iterator hint, value_type&& value) {
+    return iterator(
+        tree_type::insert_hint(hint, false, value, std::move(value)).first);
   }
-
-  std::pair<iterator, iterator> equal_range(
-      const Key& key) {  // возвращает диапазон элементов, соответствующих
-                         // определенному ключу
-    return {lower_bound(key), upper_bound(key)};
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args) {
+    return insert(hint, value_type(std::forward<Args>(args)...));
   }
 
-  iterator lower_bound(const Key& key) {  // возвращает итератор на первый
-                                          // элемент не меньше указанного ключа
-    iterator it = this->begin();
+  void swap(multiset& other) noexcept { tree_type::swap(other); }
 
-    while (it != this->end()) {
-      // если текущий элемент не меньше ключа, возвращаем этот итератор
-      if (key <= *it) {
-        return it;
-      }
-      ++it;
-    }
-    return this->end();
+  // как у set, но равные ключи все вставляются в порядке аргументов
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<Key, Key>> items;
+    items.reserve(sizeof...(Args));
+    (items.push_back({args, args}), ...);
+    return tree_type::template insert_bulk<iterator>(items, false);
   }
-
-  iterator upper_bound(const Key& key) {  // возвращает итератор на первый
-                                          // элемент, больший указанного ключа
-    iterator it = this->begin();
-
-    // проходим по элементам контейнера
-    while (it != this->end()) {
-      // если текущий элемент строго больше ключа, возвращаем этот итератор
-      if (key < *it) {
-        return it;
-      }
-      ++it;
-    }
-    // если не найден элемент, строго больший ключа, возвращаем end()
-    return this->end();
+  template <typename InputIt,
+            typename = std::enable_if_t<is_iterator_of_v<InputIt, Key>>>
+  s21::vector<std::pair<iterator, bool>> insert_many(InputIt first,
+                                                     InputIt last) {
+    s21::vector<std::pair<Key, Key>> items = this->make_items(first, last);
+    return tree_type::template insert_bulk<iterator>(items, false);
   }
+  void merge(multiset& other) { tree_type::merge(other); }
 
-  void erase(iterator pos) {
-    if (pos != nullptr)
-      rbtree<Key, Key>::erase(typename rbtree<Key, Key>::TreeIterator(
-          rbtree<Key, Key>::getNode({*pos, *pos})));
+  // count, lower_bound, upper_bound и equal_range - спуском по дереву из
+  // set и rbtree; find дает первую из равных копий
+  iterator find(const Key& key) {
+    return iterator(tree_type::findNode(key));
   }
+
+  void erase(iterator pos) { tree_type::erase(pos); }
 };
 }  // namespace s21
 
@@ -2,10 +2,15 @@
 #define CPP_S21_CONTAINERS_H
 
 #include "containers/s21_list.h"
+#include "containers/s21_lockfree_stack.h"
 #include "containers/s21_map.h"
+#include "containers/s21_mpmc_queue.h"
+#include "containers/s21_priority_queue.h"
 #include "containers/s21_queue.h"
 #include "containers/s21_set.h"
+#include "containers/s21_spsc_queue.h"
 #include "containers/s21_stack.h"
+#include "containers/s21_unordered_map.h"
 #include "containers/s21_vector.h"
 
 #endif
\ No newline at end of file
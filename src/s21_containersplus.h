@@ -2,6 +2,7 @@
 #define CPP_S21_CONTAINERS_PLUS_H
 
 #include "containersplus/s21_array.h"
+#include "containersplus/s21_counted_multiset.h"
 #include "containersplus/s21_multiset.h"
 
 #endif
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -373,6 +376,370 @@ TEST(List, Insert_Many_Front) {
   EXPECT_EQ(*our_it, 2);
 }
 
+TEST(List, PushFrontEmptySize) {
+  s21::list<int> our_list;
+  our_list.push_front(1);
+  EXPECT_EQ(our_list.size(), 1);
+  our_list.push_front(2);
+  EXPECT_EQ(our_list.size(), 2);
+}
+
+TEST(List, PushMoveOnly) {
+  s21::list<std::unique_ptr<int>> our_list;
+  our_list.push_back(std::make_unique<int>(2));
+  our_list.push_front(std::make_unique<int>(1));
+  EXPECT_EQ(*our_list.front(), 1);
+  EXPECT_EQ(*our_list.back(), 2);
+}
+
+TEST(List, PushBackMovesValue) {
+  s21::list<std::string> our_list;
+  std::string s(100, 'x');
+  our_list.push_back(std::move(s));
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(our_list.front(), std::string(100, 'x'));
+}
+
+TEST(List, Emplace) {
+  s21::list<std::pair<int, std::string>> our_list;
+  our_list.emplace_back(2, "two");
+  auto &front = our_list.emplace_front(1, "one");
+  EXPECT_EQ(front.second, "one");
+  auto it = our_list.emplace(our_list.end(), 3, "three");
+  EXPECT_EQ((*it).first, 3);
+  EXPECT_EQ(our_list.size(), 3);
+  EXPECT_EQ(our_list.back().second, "three");
+}
+
+TEST(List, MoveKeepsNodes) {
+  s21::list<int> our_list{1, 2, 3};
+  const int *first = &our_list.front();
+  s21::list<int> moved(std::move(our_list));
+  EXPECT_EQ(&moved.front(), first);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_TRUE(our_list.empty());
+
+  s21::list<int> other{9};
+  other = std::move(moved);
+  EXPECT_EQ(&other.front(), first);
+  EXPECT_EQ(other.back(), 3);
+  EXPECT_TRUE(moved.empty());
+  static_assert(std::is_nothrow_move_constructible_v<s21::list<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::list<int>>);
+}
+
+TEST(List, Insert_Many_End_And_Range) {
+  s21::list<std::string> our_list = {"a"};
+  auto it = our_list.insert_many(our_list.cend(), "b", "c");
+  EXPECT_EQ(*it, "c");
+  EXPECT_EQ(our_list.back(), "c");
+  EXPECT_EQ(our_list.size(), 3);
+
+  std::vector<std::string> src{"x", "y"};
+  our_list.insert_many(our_list.cbegin(), src.begin(), src.end());
+  EXPECT_EQ(our_list.front(), "x");
+  EXPECT_EQ(our_list.size(), 5);
+  const char *expected[] = {"x", "y", "a", "b", "c"};
+  int i = 0;
+  for (const auto &value : our_list) EXPECT_EQ(value, expected[i++]);
+}
+
+TEST(List, EndDecrementReachesBack) {
+  s21::list<int> our_list{1, 2, 3};
+  auto it = our_list.end();
+  --it;
+  EXPECT_EQ(*it, 3);
+  --it;
+  EXPECT_EQ(*it, 2);
+  s21::list<int> empty;
+  EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(List, InsertEraseAtIterator) {
+  s21::list<int> our_list{1, 2, 4, 5};
+  std::list<int> std_list{1, 2, 4, 5};
+  auto it = our_list.begin();
+  ++it;
+  ++it;
+  auto inserted = our_list.insert(it, 3);
+  EXPECT_EQ(*inserted, 3);
+  EXPECT_EQ(*it, 4);
+  auto next = our_list.erase(it);
+  EXPECT_EQ(*next, 5);
+  our_list.insert(our_list.end(), 6);
+  auto std_it = std::next(std_list.begin(), 2);
+  std_list.insert(std_it, 3);
+  std_list.erase(std_it);
+  std_list.insert(std_list.end(), 6);
+  EXPECT_EQ(our_list.size(), std_list.size());
+  auto our_it = our_list.begin();
+  for (int value : std_list) EXPECT_EQ(*our_it++, value);
+  EXPECT_TRUE(our_it == our_list.end());
+  EXPECT_EQ(our_list.back(), 6);
+  EXPECT_ANY_THROW(our_list.erase(our_list.end()));
+}
+
+TEST(List, UniqueUpdatesSize) {
+  s21::list<int> our_list{1, 1, 2, 2, 2, 3, 1};
+  our_list.unique();
+  EXPECT_EQ(our_list.size(), 4);
+  EXPECT_EQ(our_list.back(), 1);
+}
+
+TEST(List, SwapRelinksEnds) {
+  s21::list<int> first{1, 2};
+  s21::list<int> second;
+  first.swap(second);
+  EXPECT_TRUE(first.begin() == first.end());
+  EXPECT_EQ(*(--second.end()), 2);
+  second.push_back(3);
+  first.push_back(0);
+  EXPECT_EQ(second.size(), 3);
+  EXPECT_EQ(second.back(), 3);
+  EXPECT_EQ(first.front(), 0);
+}
+
+TEST(List, SpliceMovesNodes) {
+  s21::list<int> first{1, 5};
+  s21::list<int> second{2, 3, 4};
+  auto moved = second.begin();
+  auto pos = first.begin();
+  ++pos;
+  first.splice(pos, second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_TRUE(second.begin() == second.end());
+  EXPECT_EQ(first.size(), 5);
+  EXPECT_EQ(*moved, 2);
+  int expected = 1;
+  for (int value : first) EXPECT_EQ(value, expected++);
+  EXPECT_EQ(*(--first.end()), 5);
+}
+
+TEST(List, SpliceElementAndRange) {
+  s21::list<int> first{1, 2, 3, 4, 5};
+  s21::list<int> second{10};
+  auto it = first.begin();
+  ++it;
+  second.splice(second.end(), first, it);
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(first.size(), 4);
+  EXPECT_EQ(second.size(), 2);
+  EXPECT_EQ(second.back(), 2);
+
+  auto range_first = first.begin();
+  ++range_first;
+  auto range_last = first.end();
+  --range_last;
+  second.splice(second.begin(), first, range_first, range_last);
+  EXPECT_EQ(first.size(), 2);
+  EXPECT_EQ(second.size(), 4);
+  const int expected_first[] = {1, 5};
+  const int expected_second[] = {3, 4, 10, 2};
+  int i = 0;
+  for (int value : first) EXPECT_EQ(value, expected_first[i++]);
+  i = 0;
+  for (int value : second) EXPECT_EQ(value, expected_second[i++]);
+
+  first.splice(first.begin(), first, --first.end(), first.end());
+  EXPECT_EQ(first.front(), 5);
+  EXPECT_EQ(first.back(), 1);
+  EXPECT_EQ(first.size(), 2);
+}
+
+TEST(List, MergeRelinksStably) {
+  using Item = std::pair<int, char>;
+  struct ByKey {
+    Item item;
+    bool operator<(const ByKey &other) const {
+      return item.first < other.item.first;
+    }
+  };
+  s21::list<ByKey> first{{{1, 'a'}}, {{3, 'a'}}, {{5, 'a'}}};
+  s21::list<ByKey> second{{{0, 'b'}}, {{3, 'b'}}, {{4, 'b'}}, {{7, 'b'}}};
+  auto moved = --second.end();
+  first.merge(second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(first.size(), 7);
+  EXPECT_TRUE(moved == --first.end());
+  const Item expected[] = {{0, 'b'}, {1, 'a'}, {3, 'a'}, {3, 'b'},
+                           {4, 'b'}, {5, 'a'}, {7, 'b'}};
+  int i = 0;
+  for (const ByKey &value : first) EXPECT_EQ(value.item, expected[i++]);
+  first.merge(first);
+  EXPECT_EQ(first.size(), 7);
+}
+
+TEST(List, SortComparatorStable) {
+  using Item = std::pair<int, int>;
+  s21::list<Item> our_list;
+  std::list<Item> std_list;
+  for (int i = 0; i < 1000; i++) {
+    Item item{(i * 7919) % 13, i};
+    our_list.push_back(item);
+    std_list.push_back(item);
+  }
+  auto by_key_desc = [](const Item &a, const Item &b) {
+    return a.first > b.first;
+  };
+  our_list.sort(by_key_desc);
+  std_list.sort(by_key_desc);
+  EXPECT_EQ(our_list.size(), std_list.size());
+  auto our_it = our_list.begin();
+  for (const Item &item : std_list) EXPECT_EQ(*our_it++, item);
+  EXPECT_EQ(*(--our_list.end()), std_list.back());
+}
+
+TEST(List, SortRunsAndLargeInput) {
+  s21::list<int> our_list;
+  std::list<int> std_list;
+  const int n = 500000;
+  for (int i = 0; i < n; i++) {
+    // возрастающие, убывающие и случайные куски подряд
+    int value = i % 3000 < 1000   ? i
+                : i % 3000 < 2000 ? n - i
+                                  : static_cast<int>(i * 48271LL % 10007);
+    our_list.push_back(value);
+    std_list.push_back(value);
+  }
+  our_list.sort();
+  std_list.sort();
+  EXPECT_EQ(our_list.size(), static_cast<size_t>(n));
+  auto our_it = our_list.begin();
+  bool same = true;
+  for (int value : std_list) same = same && *our_it++ == value;
+  EXPECT_TRUE(same);
+  EXPECT_EQ(our_list.back(), std_list.back());
+
+  our_list.sort(std::greater<int>());
+  EXPECT_EQ(our_list.front(), std_list.back());
+  EXPECT_EQ(our_list.back(), std_list.front());
+}
+
+TEST(List, PoolAllocator) {
+  s21::list<std::string, s21::pool_allocator> our_list;
+  std::list<std::string> std_list;
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 500; i++) {
+      our_list.push_back(std::to_string(i));
+      std_list.push_back(std::to_string(i));
+    }
+    for (int i = 0; i < 200; i++) {
+      our_list.pop_front();
+      std_list.pop_front();
+    }
+    EXPECT_EQ(our_list.size(), std_list.size());
+    auto our_it = our_list.begin();
+    for (const auto &value : std_list) EXPECT_EQ(*our_it++, value);
+  }
+  our_list.clear();
+  EXPECT_TRUE(our_list.empty());
+
+  s21::list<int, s21::pool_allocator> ints{3, 1, 2};
+  ints.clear();
+  ints.push_back(4);
+  EXPECT_EQ(ints.front(), 4);
+  EXPECT_EQ(ints.size(), 1);
+}
+
+TEST(List, SplicePrivatePoolsMovesElements) {
+  s21::list<std::string, s21::pool_allocator> first{"a", "d"};
+  {
+    s21::list<std::string, s21::pool_allocator> second{"b", "c"};
+    first.splice(--first.end(), second);
+    EXPECT_TRUE(second.empty());
+    second.push_back("e");
+    first.merge(second);
+  }
+  const char *expected[] = {"a", "b", "c", "d", "e"};
+  EXPECT_EQ(first.size(), 5);
+  int i = 0;
+  for (const auto &value : first) EXPECT_EQ(value, expected[i++]);
+}
+
+TEST(List, SharedPoolRelinksAcrossLists) {
+  using SharedList = s21::list<int, s21::shared_pool_allocator>;
+  s21::shared_pool pool;
+  SharedList first(pool);
+  for (int value : {1, 3, 5}) first.push_back(value);
+  auto moved = first.begin();
+  {
+    SharedList second(pool);
+    for (int value : {0, 2, 4}) second.push_back(value);
+    second.merge(first);
+    EXPECT_TRUE(first.empty());
+    first.splice(first.end(), second);
+  }
+  EXPECT_EQ(*moved, 1);
+  EXPECT_EQ(first.size(), 6);
+  int expected = 0;
+  for (int value : first) EXPECT_EQ(value, expected++);
+  SharedList third(std::move(first));
+  EXPECT_EQ(third.back(), 5);
+  EXPECT_EQ(third.get_allocator().pool, &pool);
+
+  // копия берет тот же пул, и ее узлы перевязываются без копирования
+  SharedList copy(third);
+  auto copied = copy.begin();
+  third.splice(third.begin(), copy);
+  EXPECT_EQ(third.begin(), copied);
+  EXPECT_EQ(third.size(), 12);
+}
+
+TEST(List, SharedPoolsStaySeparate) {
+  using SharedList = s21::list<std::string, s21::shared_pool_allocator>;
+  s21::shared_pool first_pool;
+  SharedList unpooled{"x"};
+  {
+    s21::shared_pool second_pool;
+    SharedList first(first_pool), second(second_pool);
+    first.push_back("a");
+    second.push_back("b");
+    // разные пулы: узлы копируются в пул приемника
+    first.splice(first.end(), second);
+    unpooled.splice(unpooled.end(), first);
+    EXPECT_TRUE(first.empty());
+    EXPECT_TRUE(second.empty());
+  }
+  // second_pool уже разрушен - узлы unpooled от него не зависят
+  EXPECT_EQ(unpooled.size(), 3);
+  EXPECT_EQ(unpooled.back(), "b");
+  EXPECT_EQ(unpooled.get_allocator().pool, nullptr);
+}
+
+TEST(List, SortThrowingComparatorKeepsNodes) {
+  s21::list<int> our_list;
+  std::vector<int> values;
+  for (int i = 0; i < 200; i++) {
+    int value = (i * 37) % 101;
+    our_list.push_back(value);
+    values.push_back(value);
+  }
+  for (int limit : {0, 3, 50, 400, 1000}) {
+    int calls = 0;
+    auto comp = [&calls, limit](int a, int b) {
+      if (calls++ == limit) throw std::runtime_error("comparator");
+      return a < b;
+    };
+    EXPECT_THROW(our_list.sort(comp), std::runtime_error);
+    // все элементы на месте и список обходится в обе стороны
+    std::vector<int> seen;
+    for (int value : our_list) seen.push_back(value);
+    std::vector<int> backwards;
+    for (auto it = --our_list.end(); backwards.size() < our_list.size();
+         --it) {
+      backwards.push_back(*it);
+    }
+    EXPECT_EQ(seen, std::vector<int>(backwards.rbegin(), backwards.rend()));
+    std::sort(seen.begin(), seen.end());
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(seen, expected);
+    EXPECT_EQ(our_list.size(), values.size());
+  }
+  our_list.sort();
+  EXPECT_TRUE(std::is_sorted(our_list.begin(), our_list.end()));
+}
+
 // int main(int argc, char **argv) {
 //   std::cout << "======================= LIST TESTS ======================="
 //             << std::endl;
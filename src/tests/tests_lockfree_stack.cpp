@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+
+TEST(Lockfree_Stack, PushPop) {
+  s21::lockfree_stack<std::string> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.size(), 0);
+
+  s.push("a");
+  s.push(std::string("b"));
+  s.emplace(3, 'c');
+  EXPECT_FALSE(s.empty());
+  EXPECT_EQ(s.size(), 3);
+
+  std::string out;
+  EXPECT_TRUE(s.try_pop(out));
+  EXPECT_EQ(out, "ccc");
+  EXPECT_TRUE(s.try_pop(out));
+  EXPECT_EQ(out, "b");
+  s.push("d");
+  EXPECT_TRUE(s.try_pop(out));
+  EXPECT_EQ(out, "d");
+  EXPECT_TRUE(s.try_pop(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_FALSE(s.try_pop(out));
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(Lockfree_Stack, GrowsAndDestroysRemaining) {
+  s21::lockfree_stack<std::unique_ptr<int>> s;
+  for (int i = 0; i < 10000; i++) s.push(std::make_unique<int>(i));
+  EXPECT_EQ(s.size(), 10000);
+  std::unique_ptr<int> out;
+  for (int i = 9999; i >= 5000; i--) {
+    ASSERT_TRUE(s.try_pop(out));
+    EXPECT_EQ(*out, i);
+  }
+  EXPECT_EQ(s.size(), 5000);
+}
+
+TEST(Lockfree_Stack, ManyThreads) {
+  const int threads_count = 4, per_thread = 50000;
+  s21::lockfree_stack<int> s;
+  std::atomic<long long> sum(0);
+  std::atomic<int> popped(0);
+
+  // каждый поток кладет свои значения и вперемешку снимает чужие
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threads_count; t++) {
+    threads.emplace_back([&, t] {
+      long long local = 0;
+      int count = 0;
+      int value;
+      for (int i = 0; i < per_thread; i++) {
+        s.push(t * per_thread + i);
+        if (i % 2 == 1) {
+          for (int k = 0; k < 2; k++) {
+            if (s.try_pop(value)) {
+              local += value;
+              count++;
+            }
+          }
+        }
+      }
+      sum += local;
+      popped += count;
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  int value;
+  while (s.try_pop(value)) {
+    sum += value;
+    popped++;
+  }
+  long long total = threads_count * per_thread;
+  EXPECT_EQ(popped.load(), total);
+  EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.size(), 0);
+}
+
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <memory>
+#include <string>
 
 #include "../s21_containers.h"
 
@@ -353,6 +355,261 @@ TEST(Map_Operations, InsertMany) {
   EXPECT_EQ(i, 6);
 }
 
+TEST(Map_Operations, FindLarge) {
+  s21::map<int, int> m;
+  std::map<int, int> m2;
+  for (int i = 0; i < 1000; i++) {
+    int key = (i * 7919) % 1000;
+    m.insert(key, i);
+    m2.insert({key, i});
+  }
+
+  for (int key = -5; key < 1005; key++) {
+    auto it = m.find(key);
+    if (m2.count(key)) {
+      ASSERT_TRUE(it != m.end());
+      EXPECT_EQ((*it).first, key);
+      EXPECT_EQ(m.at(key), m2.at(key));
+      EXPECT_TRUE(m.contains(key));
+    } else {
+      EXPECT_TRUE(it == m.end());
+      EXPECT_FALSE(m.contains(key));
+    }
+  }
+}
+
+TEST(Map_Operations, SizeTracking) {
+  s21::map<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+
+  for (int i = 0; i < 100; i++) m.insert(i, i);
+  m.insert(5, 5);
+  EXPECT_EQ(m.size(), 100);
+
+  for (int i = 0; i < 50; i++) m.erase(m.find(i * 2));
+  EXPECT_EQ(m.size(), 50);
+
+  s21::map<int, int> m2 = {{1000, 1}, {1001, 1}};
+  m.swap(m2);
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_EQ(m2.size(), 50);
+
+  m.merge(m2);
+  EXPECT_EQ(m.size(), 52);
+  EXPECT_TRUE(m2.empty());
+
+  m.clear();
+  EXPECT_EQ(m.size(), 0);
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(Map_Operations, PoolAllocator) {
+  s21::map<int, int, s21::pool_allocator> m;
+  std::map<int, int> m2;
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 1000; i++) {
+      m.insert(i, i * round);
+      m2.insert({i, i * round});
+    }
+    for (int i = 0; i < 1000; i += 3) {
+      m.erase(m.find(i));
+      m2.erase(i);
+    }
+    EXPECT_EQ(m.size(), m2.size());
+    auto it2 = m2.begin();
+    for (auto it1 = m.begin(); it1 != m.end(); it1++, it2++)
+      EXPECT_EQ((*it1).first, it2->first);
+    m.clear();
+    m2.clear();
+    EXPECT_TRUE(m.empty());
+  }
+
+  s21::map<int, int, s21::pool_allocator> m3 = {{1, 1}, {2, 2}};
+  m.insert(7, 7);
+  m.swap(m3);
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_EQ(m3.at(7), 7);
+}
+
+TEST(Map_Constructors, MoveKeepsNodes) {
+  s21::map<int, int, s21::pool_allocator> m1 = {{1, 1}, {2, 2}, {3, 3}};
+  int *value = &m1.at(2);
+  s21::map<int, int, s21::pool_allocator> m2(std::move(m1));
+  EXPECT_EQ(&m2.at(2), value);
+  EXPECT_TRUE(m1.empty());
+
+  s21::map<int, int, s21::pool_allocator> m3 = {{7, 7}};
+  m3 = std::move(m2);
+  EXPECT_EQ(&m3.at(2), value);
+  EXPECT_EQ(m3.size(), 3);
+  EXPECT_FALSE(m3.contains(7));
+  m1.insert(5, 5);
+  EXPECT_EQ(m1.size(), 1);
+  static_assert(std::is_nothrow_move_constructible_v<s21::map<int, int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::map<int, int>>);
+}
+
+TEST(Map_Operations, InsertManyResults) {
+  s21::map<int, std::string> m = {{2, "old"}};
+  auto results = m.insert_many(std::pair(3, "c"), std::pair(2, "b"),
+                               std::pair(1, "a"), std::pair(3, "dup"));
+  EXPECT_EQ(results.size(), 4);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+  EXPECT_TRUE(results[2].second);
+  EXPECT_FALSE(results[3].second);
+  EXPECT_EQ(results[1].first.getValue(), "old");
+  EXPECT_EQ(results[3].first.getValue(), "c");
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_EQ(m.at(3), "c");
+}
+
+TEST(Map_Operations, InsertManyRange) {
+  std::map<int, int> src;
+  for (int i = 0; i < 5000; i++) src[(i * 7919) % 5000] = i;
+  s21::map<int, int> m;
+  for (int i = 0; i < 5000; i += 3) m.insert(i, -1);
+  auto it_before = m.find(3);
+  m.insert_many(src.begin(), src.end());
+  EXPECT_EQ(m.size(), 5000);
+  EXPECT_EQ(m.at(3), -1);
+  EXPECT_TRUE(m.find(3) == it_before);
+  int expected = 0;
+  for (auto value : m) EXPECT_EQ(value.first, expected++);
+}
+
+TEST(Map_Operations, Bounds) {
+  s21::map<int, std::string> m{{1, "a"}, {3, "c"}, {5, "e"}};
+  EXPECT_EQ((*m.lower_bound(3)).second, "c");
+  EXPECT_EQ((*m.upper_bound(3)).first, 5);
+  EXPECT_EQ((*m.lower_bound(2)).first, 3);
+  EXPECT_TRUE(m.upper_bound(5) == m.end());
+  auto range = m.equal_range(1);
+  EXPECT_EQ((*range.first).first, 1);
+  EXPECT_EQ((*range.second).first, 3);
+  EXPECT_EQ(m.count(5), 1);
+  EXPECT_EQ(m.count(4), 0);
+}
+
+TEST(Map_Operations, NthAndRank) {
+  s21::map<int, std::string, s21::node_allocator, true> m;
+  for (int key = 0; key < 100; key += 2) m.insert(key, std::to_string(key));
+  for (int key = 0; key < 100; key += 4) m.erase(m.find(key));
+  // остались 2, 6, 10, ..., 98
+  EXPECT_EQ((*m.nth(0)).first, 2);
+  EXPECT_EQ((*m.nth(3)).second, "14");
+  EXPECT_TRUE(m.nth(25) == m.end());
+  EXPECT_EQ(m.rank(2), 0U);
+  EXPECT_EQ(m.rank(14), 3U);
+  EXPECT_EQ(m.rank(15), 4U);
+  EXPECT_EQ(m.rank(1000), m.size());
+}
+
+TEST(Map_Operations, CopyAndMergeKeepUniqueKeys) {
+  s21::map<int, int, s21::pool_allocator> m, other;
+  for (int key = 0; key < 1000; key += 2) m.insert(key, key);
+  for (int key = 0; key < 1000; key += 3) other.insert(key, -key);
+  s21::map<int, int, s21::pool_allocator> copy(m);
+  EXPECT_EQ(copy.size(), m.size());
+  copy[0] = 42;
+  EXPECT_EQ(m[0], 0);
+
+  m.merge(other);
+  std::map<int, int> expected, rest;
+  for (int key = 0; key < 1000; key += 2) expected[key] = key;
+  for (int key = 0; key < 1000; key += 3) {
+    if (!expected.count(key)) expected[key] = -key;
+    if (key % 2 == 0) rest[key] = -key;
+  }
+  // ключи, которые уже были в m, остаются в other со своими значениями
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = expected.begin();
+  for (auto item : m) {
+    EXPECT_EQ(item.first, it->first);
+    EXPECT_EQ(item.second, it->second);
+    ++it;
+  }
+  ASSERT_EQ(other.size(), rest.size());
+  it = rest.begin();
+  for (auto item : other) {
+    EXPECT_EQ(item.first, it->first);
+    EXPECT_EQ(item.second, it->second);
+    ++it;
+  }
+}
+
+TEST(Map_Insert, Hint) {
+  s21::map<int, std::string> m;
+  auto it = m.end();
+  for (int key = 0; key < 100; key++) {
+    it = m.insert(m.end(), {key, std::to_string(key)});
+    EXPECT_EQ((*it).first, key);
+  }
+  // подсказка мимо: ключ все равно встает на свое место
+  it = m.emplace_hint(m.begin(), 1000, "last");
+  EXPECT_EQ((*it).second, "last");
+  it = m.insert(m.find(50), {49, "again"});
+  EXPECT_EQ((*it).second, "49");
+  EXPECT_EQ(m.size(), 101U);
+  int expected = 0;
+  for (auto item : m) {
+    if (expected == 100) expected = 1000;
+    EXPECT_EQ(item.first, expected++);
+  }
+}
+
+TEST(Map_Operations, SharedPoolMerge) {
+  using SharedMap = s21::map<int, int, s21::shared_pool_allocator>;
+  s21::shared_pool pool;
+  SharedMap m(pool), other(pool);
+  for (int i = 0; i < 100; i += 2) m.insert(i, i);
+  for (int i = 0; i < 100; i += 3) other.insert(i, -i);
+  auto moved = other.find(3);
+  m.merge(other);  // общий пул: узлы other перевязываются
+  EXPECT_EQ(m.size(), 67);
+  EXPECT_EQ(other.size(), 17);
+  EXPECT_EQ(m.find(3), moved);
+  EXPECT_EQ(m.at(6), 6);
+
+  SharedMap copy(m);
+  EXPECT_EQ(copy.get_allocator().pool, &pool);
+  SharedMap unpooled;
+  unpooled.merge(copy);  // разные пулы: элементы копируются
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(unpooled.size(), 67);
+  EXPECT_EQ(unpooled.at(99), -99);
+}
+
+// считает копии: emplace_hint и insert(hint, value_type&&) их не делают
+struct CopyCounter {
+  static int copies;
+  int value;
+  CopyCounter(int v) : value(v) {}
+  CopyCounter(const CopyCounter& other) : value(other.value) { copies++; }
+  CopyCounter(CopyCounter&&) noexcept = default;
+};
+int CopyCounter::copies = 0;
+
+TEST(Map_Insert, HintMovesValues) {
+  s21::map<int, std::unique_ptr<int>> owners;
+  owners.emplace_hint(owners.end(), 1, std::make_unique<int>(10));
+  owners.insert(owners.end(), {2, std::make_unique<int>(20)});
+  owners.emplace_hint(owners.begin(),
+                      std::make_pair(0, std::make_unique<int>(0)));
+  EXPECT_EQ(owners.size(), 3U);
+  for (int key = 0; key < 3; key++) EXPECT_EQ(*owners.at(key), key * 10);
+
+  s21::map<int, CopyCounter> m;
+  CopyCounter::copies = 0;
+  for (int key = 0; key < 10; key++) m.emplace_hint(m.end(), key, key);
+  m.insert(m.end(), {10, CopyCounter(10)});
+  m.emplace_hint(m.end(), std::make_pair(11, CopyCounter(11)));
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(m.size(), 12U);
+  EXPECT_EQ(m.at(11).value, 11);
+}
+
 // int main(int argc, char **argv) {
 //   std::cout << "======================= MAP TESTS ======================="
 //             << std::endl;
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+
+TEST(Mpmc_Queue, TryPushPop) {
+  s21::mpmc_queue<std::string> q(2);
+  EXPECT_EQ(q.capacity(), 2);
+  EXPECT_TRUE(q.empty());
+
+  EXPECT_TRUE(q.try_push("a"));
+  EXPECT_TRUE(q.try_push(std::string("b")));
+  EXPECT_FALSE(q.try_push("c"));
+  EXPECT_EQ(q.size(), 2);
+
+  std::string out;
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_TRUE(q.try_push("c"));
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "b");
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "c");
+  EXPECT_FALSE(q.try_pop(out));
+}
+
+TEST(Mpmc_Queue, Close) {
+  s21::mpmc_queue<int> q(4);
+  EXPECT_TRUE(q.push(1));
+  EXPECT_TRUE(q.push(2));
+  q.close();
+
+  EXPECT_TRUE(q.is_closed());
+  EXPECT_FALSE(q.push(3));
+  EXPECT_FALSE(q.try_push(3));
+
+  int out = 0;
+  EXPECT_TRUE(q.pop(out));
+  EXPECT_EQ(out, 1);
+  EXPECT_TRUE(q.pop(out));
+  EXPECT_EQ(out, 2);
+  EXPECT_FALSE(q.pop(out));
+}
+
+TEST(Mpmc_Queue, CloseWakesWaiters) {
+  s21::mpmc_queue<int> q(4);
+  std::thread consumer([&] {
+    int out;
+    EXPECT_FALSE(q.pop(out));
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  q.close();
+  consumer.join();
+}
+
+TEST(Mpmc_Queue, ManyProducersConsumers) {
+  const int producers = 4, consumers = 4, per_producer = 20000;
+  s21::mpmc_queue<int> q(16);
+  std::atomic<long long> sum(0);
+  std::atomic<int> received(0);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&, p] {
+      for (int i = 0; i < per_producer; i++)
+        EXPECT_TRUE(q.push(p * per_producer + i));
+    });
+  }
+  for (int c = 0; c < consumers; c++) {
+    threads.emplace_back([&] {
+      int value;
+      while (q.pop(value)) {
+        sum += value;
+        received++;
+      }
+    });
+  }
+  for (int p = 0; p < producers; p++) threads[p].join();
+  q.close();
+  for (int c = 0; c < consumers; c++) threads[producers + c].join();
+
+  long long total = producers * per_producer;
+  EXPECT_EQ(received.load(), total);
+  EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+}
+
+// копия бросает до захвата ячейки: очередь остается целой
+struct ThrowingCopy {
+  static bool fail;
+  int value;
+  explicit ThrowingCopy(int v = 0) : value(v) {}
+  ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+    if (fail) throw std::runtime_error("copy");
+  }
+  ThrowingCopy(ThrowingCopy&&) noexcept = default;
+  ThrowingCopy& operator=(const ThrowingCopy&) = default;
+  ThrowingCopy& operator=(ThrowingCopy&&) noexcept = default;
+};
+bool ThrowingCopy::fail = false;
+
+TEST(Mpmc_Queue, ThrowingCopyKeepsQueueUsable) {
+  s21::mpmc_queue<ThrowingCopy> q(4);
+  ThrowingCopy item(1);
+  ThrowingCopy::fail = true;
+  EXPECT_THROW(q.try_push(item), std::runtime_error);
+  EXPECT_THROW(q.push(item), std::runtime_error);
+  ThrowingCopy::fail = false;
+  EXPECT_TRUE(q.empty());
+  EXPECT_TRUE(q.try_push(item));
+  EXPECT_TRUE(q.try_push(ThrowingCopy(2)));
+
+  std::thread consumer([&] {
+    ThrowingCopy out;
+    for (int expected = 1; expected <= 2; expected++) {
+      EXPECT_TRUE(q.pop(out));
+      EXPECT_EQ(out.value, expected);
+    }
+  });
+  consumer.join();
+  EXPECT_TRUE(q.empty());
+}
@@ -1,5 +1,7 @@
 #include <set>
+#include <vector>
 
+#include "../containersplus/s21_counted_multiset.h"
 #include "../containersplus/s21_multiset.h"
 #include "gtest/gtest.h"
 
@@ -243,6 +245,13 @@ TEST(Multiset_Operations, Find) {
   EXPECT_EQ(*it, 2);
 }
 
+TEST(Multiset_Operations, FindDuplicate) {
+  s21::multiset<int> m = {3, 1, 2, 2, 2, 5};
+  auto it = m.find(2);
+  EXPECT_TRUE(it == m.lower_bound(2));
+  EXPECT_TRUE(m.find(4) == m.end());
+}
+
 TEST(Multiset_Functions, InsertMany) {
   s21::set<int> s;
   s.insert_many(1, 2, 3, 4, 5, 6);
@@ -252,6 +261,229 @@ TEST(Multiset_Functions, InsertMany) {
   EXPECT_EQ(6, s.size());
 }
 
+TEST(Multiset_Operations, EraseDuplicates) {
+  s21::multiset<int> m;
+  std::multiset<int> m2;
+  for (int i = 0; i < 300; i++) {
+    m.insert(i % 17);
+    m2.insert(i % 17);
+  }
+  for (int i = 0; i < 50; i++) {
+    m.erase(m.find(i % 5));
+    m2.erase(m2.find(i % 5));
+  }
+
+  EXPECT_EQ(m.size(), m2.size());
+  auto it2 = m2.begin();
+  for (auto it1 = m.begin(); it1 != m.end(); it1++, it2++)
+    EXPECT_EQ(*it1, *it2);
+}
+
+TEST(Multiset_Constructors, MoveKeepsNodes) {
+  s21::multiset<int> m1 = {1, 1, 2};
+  auto first = m1.begin();
+  s21::multiset<int> m2(std::move(m1));
+  EXPECT_TRUE(m2.begin() == first);
+  EXPECT_EQ(m2.size(), 3);
+  EXPECT_TRUE(m1.empty());
+
+  s21::multiset<int> m3 = {5};
+  m3 = std::move(m2);
+  EXPECT_EQ(m3.size(), 3);
+  EXPECT_EQ(m3.count(5), 0);
+  static_assert(std::is_nothrow_move_constructible_v<s21::multiset<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::multiset<int>>);
+}
+
+TEST(Multiset_Functions, InsertManyKeepsDuplicates) {
+  s21::multiset<int> m = {2, 2};
+  auto results = m.insert_many(3, 2, 1, 2);
+  EXPECT_EQ(m.size(), 6);
+  for (const auto &result : results) EXPECT_TRUE(result.second);
+  EXPECT_EQ(m.count(2), 4);
+  std::vector<int> src(1000, 7);
+  m.insert_many(src.begin(), src.end());
+  EXPECT_EQ(m.count(7), 1000);
+  EXPECT_EQ(*m.begin(), 1);
+}
+
+TEST(Multiset_Operations, BoundsMatchStd) {
+  s21::multiset<int> m;
+  std::multiset<int> std_m;
+  for (int i = 0; i < 2000; i++) {
+    int key = (i * 7919) % 301 * 2;  // только четные, с повторами
+    m.insert(key);
+    std_m.insert(key);
+  }
+  for (int key = -3; key < 610; key++) {
+    auto lower = m.lower_bound(key);
+    auto upper = m.upper_bound(key);
+    auto std_lower = std_m.lower_bound(key);
+    auto std_upper = std_m.upper_bound(key);
+    if (std_lower == std_m.end()) {
+      ASSERT_TRUE(lower == m.end());
+    } else {
+      ASSERT_EQ(*lower, *std_lower);
+    }
+    if (std_upper == std_m.end()) {
+      ASSERT_TRUE(upper == m.end());
+    } else {
+      ASSERT_EQ(*upper, *std_upper);
+    }
+    ASSERT_EQ(m.count(key), std_m.count(key));
+    auto range = m.equal_range(key);
+    EXPECT_TRUE(range.first == lower);
+    EXPECT_TRUE(range.second == upper);
+    size_t in_range = 0;
+    for (auto it = range.first; it != range.second; ++it) in_range++;
+    ASSERT_EQ(in_range, std_m.count(key));
+  }
+  EXPECT_TRUE(m.lower_bound(4) == m.find(4));
+}
+
+TEST(Counted_Multiset, MatchesStd) {
+  s21::counted_multiset<int> counted;
+  std::multiset<int> expected;
+  for (int i = 0; i < 2000; i++) {
+    int key = (i * 7919) % 37;
+    counted.insert(key);
+    expected.insert(key);
+  }
+  EXPECT_EQ(counted.size(), expected.size());
+  EXPECT_EQ(counted.distinct_size(), 37U);
+  std::vector<int> copies;
+  for (auto it = counted.begin(); it != counted.end(); ++it) {
+    copies.push_back(*it);
+  }
+  EXPECT_EQ(copies, std::vector<int>(expected.begin(), expected.end()));
+  for (int key = -1; key < 40; key++) {
+    EXPECT_EQ(counted.count(key), expected.count(key));
+    size_t in_range = 0;
+    for (auto it = counted.lower_bound(key); it != counted.upper_bound(key);
+         ++it) {
+      EXPECT_EQ(*it, key);
+      in_range++;
+    }
+    EXPECT_EQ(in_range, expected.count(key));
+  }
+}
+
+TEST(Counted_Multiset, EraseOneCopy) {
+  s21::counted_multiset<int> counted{5, 1, 5, 5, 3};
+  auto it = counted.find(5);
+  EXPECT_EQ(it.multiplicity(), 3U);
+  counted.erase(it);
+  EXPECT_EQ(counted.count(5), 2U);
+  EXPECT_EQ(counted.size(), 4U);
+  counted.erase(counted.find(1));
+  EXPECT_FALSE(counted.contains(1));
+  EXPECT_EQ(counted.distinct_size(), 2U);
+  std::vector<int> copies;
+  for (auto it = counted.begin(); it != counted.end(); ++it) {
+    copies.push_back(*it);
+  }
+  EXPECT_EQ(copies, (std::vector<int>{3, 5, 5}));
+  auto last = counted.insert(5);
+  EXPECT_EQ(*last, 5);
+  EXPECT_EQ(++last, counted.end());
+}
+
+TEST(Counted_Multiset, CopyMergeSwap) {
+  s21::counted_multiset<int> first{1, 1, 2};
+  s21::counted_multiset<int> second{2, 3, 3, 3};
+  s21::counted_multiset<int> copy(first);
+  copy.merge(second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(copy.size(), 7U);
+  EXPECT_EQ(copy.count(2), 2U);
+  EXPECT_EQ(copy.count(3), 3U);
+  EXPECT_EQ(first.size(), 3U);
+  first.swap(copy);
+  EXPECT_EQ(first.size(), 7U);
+  EXPECT_EQ(copy.size(), 3U);
+  s21::counted_multiset<int> moved(std::move(first));
+  EXPECT_EQ(moved.count(3), 3U);
+  EXPECT_TRUE(first.empty());
+}
+
+TEST(Multiset_Operations, NthAndRankMatchStd) {
+  s21::multiset<int, s21::node_allocator, true> ours;
+  std::multiset<int> expected;
+  for (int i = 0; i < 3000; i++) {
+    int key = (i * 7919) % 211;
+    ours.insert(key);
+    expected.insert(key);
+    if (i % 3 == 0) {
+      ours.erase(ours.find(key / 2));
+      auto it = expected.find(key / 2);
+      if (it != expected.end()) expected.erase(it);
+    }
+  }
+  ASSERT_EQ(ours.size(), expected.size());
+  size_t k = 0;
+  for (int key : expected) EXPECT_EQ(*ours.nth(k++), key);
+  for (int key = -1; key < 213; key++) {
+    size_t less = 0;
+    for (auto it = expected.begin(); it != expected.lower_bound(key); ++it)
+      less++;
+    EXPECT_EQ(ours.rank(key), less);
+  }
+}
+
+TEST(Multiset_Functions, MergeMovesEveryCopy) {
+  s21::multiset<int, s21::pool_allocator> ours{5, 1, 5};
+  s21::multiset<int, s21::pool_allocator> other{5, 2, 2};
+  std::multiset<int> expected{5, 1, 5, 5, 2, 2};
+  ours.merge(other);
+  EXPECT_TRUE(other.empty());
+  s21::multiset<int, s21::pool_allocator> copy(ours);
+  EXPECT_EQ(copy.count(5), 3U);
+  std::vector<int> keys;
+  for (int key : copy) keys.push_back(key);
+  EXPECT_EQ(keys, std::vector<int>(expected.begin(), expected.end()));
+}
+
+TEST(Multiset_Functions, InsertHint) {
+  s21::multiset<int, s21::node_allocator, true> ours;
+  std::multiset<int> expected;
+  auto hint = ours.end();
+  for (int i = 0; i < 1000; i++) {
+    int key = (i * 37) % 100;
+    hint = ours.insert(i % 3 ? ours.end() : hint, key);
+    EXPECT_EQ(*hint, key);
+    expected.insert(key);
+  }
+  ours.emplace_hint(ours.find(50), 50);
+  expected.insert(50);
+  ASSERT_EQ(ours.size(), expected.size());
+  size_t k = 0;
+  for (int key : expected) EXPECT_EQ(*ours.nth(k++), key);
+  EXPECT_EQ(ours.count(50), expected.count(50));
+}
+
+TEST(Counted_Multiset, InsertZeroCopies) {
+  s21::counted_multiset<int> counted{5, 5};
+  EXPECT_EQ(counted.insert(7, 0), counted.end());
+  EXPECT_FALSE(counted.contains(7));
+  auto it = counted.insert(5, 0);
+  EXPECT_EQ(it, counted.find(5));
+  EXPECT_EQ(it.multiplicity(), 2);
+  EXPECT_EQ(counted.size(), 2);
+  EXPECT_EQ(counted.distinct_size(), 1);
+  size_t walked = 0;
+  for (auto i = counted.begin(); i != counted.end(); ++i) walked++;
+  EXPECT_EQ(walked, 2);
+}
+
+TEST(Multiset_Constructors, CopyAssignReplaces) {
+  const s21::multiset<int> a{1, 1, 2};
+  s21::multiset<int> b{7, 7, 8, 9};
+  b = a;
+  EXPECT_EQ(b.size(), 3U);
+  EXPECT_EQ(b.count(1), 2U);
+  EXPECT_FALSE(b.contains(7));
+}
+
 // int main(int argc, char **argv) {
 //   std::cout << "======================= multiset TESTS
 //   ======================="
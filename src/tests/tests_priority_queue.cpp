@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_containers.h"
+
+TEST(Priority_Queue, PushPopTop) {
+  s21::priority_queue<int> q;
+  EXPECT_TRUE(q.empty());
+  EXPECT_THROW(q.top(), std::out_of_range);
+  EXPECT_THROW(q.pop(), std::out_of_range);
+
+  for (int value : {5, 1, 8, 3, 8, 2}) q.push(value);
+  EXPECT_EQ(q.size(), 6);
+  const int expected[] = {8, 8, 5, 3, 2, 1};
+  for (int value : expected) {
+    EXPECT_EQ(q.top(), value);
+    q.pop();
+  }
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(Priority_Queue, HeapifyAndComparator) {
+  std::vector<int> values;
+  for (int i = 0; i < 1000; i++) values.push_back((i * 7919) % 1009);
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>> q(
+      values.begin(), values.end());
+  std::priority_queue<int, std::vector<int>, std::greater<int>> std_q(
+      values.begin(), values.end());
+  EXPECT_EQ(q.size(), std_q.size());
+  while (!std_q.empty()) {
+    ASSERT_EQ(q.top(), std_q.top());
+    q.pop();
+    std_q.pop();
+  }
+  EXPECT_TRUE(q.empty());
+
+  s21::priority_queue<std::string> words{"pear", "apple", "plum"};
+  EXPECT_EQ(words.top(), "plum");
+}
+
+TEST(Priority_Queue, DaryMatchesStd) {
+  s21::priority_queue<int, s21::vector<int>, std::less<int>, 4> q;
+  s21::priority_queue<int, s21::vector<int>, std::less<int>, 3> q3;
+  std::priority_queue<int> std_q;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 20000; i++) {
+    if (gen() % 3 != 0 || std_q.empty()) {
+      int value = static_cast<int>(gen() % 5000);
+      q.push(value);
+      q3.emplace(value);
+      std_q.push(value);
+    } else {
+      ASSERT_EQ(q.top(), std_q.top());
+      ASSERT_EQ(q3.top(), std_q.top());
+      q.pop();
+      q3.pop();
+      std_q.pop();
+    }
+  }
+  EXPECT_EQ(q.size(), std_q.size());
+}
+
+struct ByPointee {
+  bool operator()(const std::unique_ptr<int> &a,
+                  const std::unique_ptr<int> &b) const {
+    return *a < *b;
+  }
+};
+
+TEST(Priority_Queue, MoveOnlyAndSwap) {
+  using Queue =
+      s21::priority_queue<std::unique_ptr<int>,
+                          s21::vector<std::unique_ptr<int>>, ByPointee>;
+  Queue q;
+  for (int value : {3, 9, 1}) q.push(std::make_unique<int>(value));
+  q.emplace(new int(7));
+  EXPECT_EQ(*q.top(), 9);
+  q.pop();
+  EXPECT_EQ(*q.top(), 7);
+
+  Queue other;
+  other.push(std::make_unique<int>(100));
+  q.swap(other);
+  EXPECT_EQ(*q.top(), 100);
+  EXPECT_EQ(other.size(), 3);
+  Queue moved(std::move(other));
+  EXPECT_EQ(*moved.top(), 7);
+}
+
+TEST(Priority_Queue, RangeConstructorNeedsIterators) {
+  // (3, 4) - не диапазон: перегрузка с итераторами не должна его брать
+  static_assert(!std::is_constructible_v<s21::priority_queue<int>, int, int>);
+  using ints = s21::priority_queue<int>;
+  static_assert(std::is_constructible_v<ints, const int*, const int*>);
+  const int values[] = {3, 9, 4};
+  s21::priority_queue<int> q(values, values + 3);
+  EXPECT_EQ(q.top(), 9);
+  EXPECT_EQ(q.size(), 3U);
+}
@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+
 #include "../s21_containers.h"
 
 TEST(Queue_Constructors, Move) {
@@ -157,6 +162,98 @@ TEST(Queue_DOP, test) {
   EXPECT_EQ(size, 5);
 }
 
+TEST(Queue_Constructors, wrap_around) {
+  s21::queue<std::string> q;
+  std::queue<std::string> q2;
+  for (int i = 0; i < 1000; i++) {
+    q.push(std::to_string(i));
+    q2.push(std::to_string(i));
+    if (i % 3 == 0) {
+      EXPECT_EQ(q.front(), q2.front());
+      q.pop();
+      q2.pop();
+    }
+  }
+  s21::queue<std::string> copy = q;
+  while (!q2.empty()) {
+    EXPECT_EQ(q.front(), q2.front());
+    EXPECT_EQ(q.back(), q2.back());
+    q.pop();
+    q2.pop();
+  }
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(copy.size(), 666);
+  EXPECT_EQ(copy.front(), "334");
+}
+
+TEST(Queue_Constructors, push_own_element) {
+  s21::queue<std::string> q{"first"};
+  for (int i = 0; i < 100; i++) q.push(q.front());
+  EXPECT_EQ(q.size(), 101);
+  EXPECT_EQ(q.back(), "first");
+}
+
+TEST(Queue_Modifiers, push_move_only) {
+  s21::queue<std::unique_ptr<int>> q;
+  for (int i = 0; i < 20; i++) q.push(std::make_unique<int>(i));
+  EXPECT_EQ(q.size(), 20);
+  EXPECT_EQ(*q.front(), 0);
+  EXPECT_EQ(*q.back(), 19);
+}
+
+TEST(Queue_Modifiers, emplace) {
+  s21::queue<std::string> q;
+  for (int i = 0; i < 20; i++) q.emplace(3, 'a' + i % 26);
+  EXPECT_EQ(q.front(), "aaa");
+  EXPECT_EQ(q.back(), "ttt");
+}
+
+TEST(Queue_Modifiers, emplace_own_element) {
+  s21::queue<std::string> q{"first"};
+  for (int i = 0; i < 100; i++) q.emplace(q.front());
+  EXPECT_EQ(q.size(), 101);
+  EXPECT_EQ(q.back(), "first");
+}
+
+// перемещение не noexcept, поэтому рост буфера копирует; копия бросает
+// на заданном номере, живые объекты считаются
+struct QueueThrowingCopy {
+  static int live;
+  static int countdown;
+  int value;
+  explicit QueueThrowingCopy(int v) : value(v) { live++; }
+  QueueThrowingCopy(const QueueThrowingCopy& other) : value(other.value) {
+    if (countdown > 0 && --countdown == 0) throw std::runtime_error("copy");
+    live++;
+  }
+  QueueThrowingCopy(QueueThrowingCopy&& other) : value(other.value) {
+    live++;
+  }
+  ~QueueThrowingCopy() { live--; }
+};
+int QueueThrowingCopy::live = 0;
+int QueueThrowingCopy::countdown = 0;
+
+TEST(Queue_Modifiers, GrowThrowingCopyKeepsElements) {
+  {
+    s21::queue<QueueThrowingCopy> q;
+    for (int i = 0; i < 8; i++) q.emplace(i);  // буфер заполнен
+    q.pop();
+    q.emplace(8);  // голова не в нуле
+    QueueThrowingCopy::countdown = 4;
+    EXPECT_THROW(q.emplace(9), std::runtime_error);
+    EXPECT_EQ(q.size(), 8U);
+    EXPECT_EQ(QueueThrowingCopy::live, 8);
+    for (int expected = 1; expected <= 8; expected++) {
+      EXPECT_EQ(q.front().value, expected);
+      q.pop();
+    }
+    q.emplace(10);
+    EXPECT_EQ(q.back().value, 10);
+  }
+  EXPECT_EQ(QueueThrowingCopy::live, 0);
+}
+
 // int main(int argc, char **argv) {
 //   std::cout << "======================= queue TESTS ======================="
 //             << std::endl;
@@ -1,4 +1,7 @@
+#include <algorithm>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "../s21_containers.h"
 #include "gtest/gtest.h"
@@ -271,6 +274,170 @@ TEST(Set_Operations, Find) {
   EXPECT_EQ(*it, 2);
 }
 
+TEST(Set_Operations, FindMissing) {
+  s21::set<int> m = {1, 3, 5, 7, 9};
+  EXPECT_TRUE(m.find(4) == m.end());
+  EXPECT_TRUE(m.find(0) == m.end());
+  EXPECT_TRUE(m.find(10) == m.end());
+  EXPECT_EQ(*m.find(9), 9);
+}
+
+TEST(Set_Operations, PoolAllocatorStrings) {
+  s21::set<std::string, s21::pool_allocator> s;
+  for (int i = 0; i < 200; i++) s.insert(std::to_string(i));
+  for (int i = 0; i < 200; i += 2) s.erase(s.find(std::to_string(i)));
+
+  EXPECT_EQ(s.size(), 100);
+  EXPECT_TRUE(s.contains("1"));
+  EXPECT_FALSE(s.contains("2"));
+  s.clear();
+  EXPECT_EQ(s.size(), 0);
+  s.insert("again");
+  EXPECT_EQ(*s.begin(), "again");
+}
+
+TEST(Set_Constructors, MoveAssignReplaces) {
+  s21::set<int> s1 = {1, 2, 3};
+  auto first = s1.begin();
+  s21::set<int> s2 = {10, 20};
+  s2 = std::move(s1);
+  EXPECT_EQ(s2.size(), 3);
+  EXPECT_FALSE(s2.contains(10));
+  EXPECT_TRUE(s2.begin() == first);
+  EXPECT_TRUE(s1.empty());
+  static_assert(std::is_nothrow_move_constructible_v<s21::set<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::set<int>>);
+}
+
+TEST(Set_Functions, InsertManyDuplicates) {
+  s21::set<int> s = {5, 1};
+  auto results = s.insert_many(3, 5, 3, 2);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+  EXPECT_FALSE(results[2].second);
+  EXPECT_TRUE(results[3].second);
+  EXPECT_TRUE(results[0].first == results[2].first);
+  EXPECT_EQ(s.size(), 4);
+  int expected[] = {1, 2, 3, 5};
+  int i = 0;
+  for (const auto &val : s) EXPECT_EQ(val, expected[i++]);
+}
+
+TEST(Set_Functions, InsertManyRange) {
+  std::vector<int> src;
+  for (int i = 0; i < 10000; i++) src.push_back((i * 7919) % 3000);
+  s21::set<int> s;
+  s.insert_many(src.begin(), src.end());
+  EXPECT_EQ(s.size(), 3000);
+  int expected = 0;
+  for (const auto &val : s) EXPECT_EQ(val, expected++);
+  for (int i = 0; i < 3000; i += 2) s.erase(s.find(i));
+  s.insert_many(src.begin(), src.begin() + 10);
+  EXPECT_EQ(s.size(), 1505);
+}
+
+TEST(Set_Operations, Bounds) {
+  s21::set<int> s{10, 20, 30};
+  EXPECT_EQ(*s.lower_bound(20), 20);
+  EXPECT_EQ(*s.upper_bound(20), 30);
+  EXPECT_EQ(*s.lower_bound(15), 20);
+  EXPECT_EQ(*s.lower_bound(-5), 10);
+  EXPECT_TRUE(s.lower_bound(31) == s.end());
+  EXPECT_TRUE(s.upper_bound(30) == s.end());
+  auto range = s.equal_range(25);
+  EXPECT_TRUE(range.first == range.second);
+  EXPECT_EQ(*range.first, 30);
+  EXPECT_EQ(s.count(20), 1);
+  EXPECT_EQ(s.count(21), 0);
+  s21::set<int> empty;
+  EXPECT_TRUE(empty.lower_bound(1) == empty.end());
+  EXPECT_EQ(empty.count(1), 0);
+}
+
+TEST(Set_Operations, NthAndRank) {
+  s21::set<int, s21::pool_allocator, true> s{50, 10, 40, 20, 30};
+  EXPECT_EQ(*s.nth(0), 10);
+  EXPECT_EQ(*s.nth(4), 50);
+  EXPECT_TRUE(s.nth(5) == s.end());
+  EXPECT_EQ(s.rank(30), 2U);
+  EXPECT_EQ(s.rank(35), 3U);
+  s.erase(s.find(20));
+  EXPECT_EQ(*s.nth(1), 30);
+  EXPECT_EQ(s.rank(30), 1U);
+}
+
+TEST(Set_Functions, MergeLeavesExistingKeys) {
+  s21::set<int> s{1, 3, 5, 7};
+  s21::set<int> other{2, 3, 4, 7};
+  s.merge(other);
+  EXPECT_EQ(s.size(), 6U);
+  std::vector<int> rest;
+  for (int key : other) rest.push_back(key);
+  EXPECT_EQ(rest, (std::vector<int>{3, 7}));
+  s21::set<int> copy(s);
+  std::vector<int> keys;
+  for (int key : copy) keys.push_back(key);
+  EXPECT_EQ(keys, (std::vector<int>{1, 2, 3, 4, 5, 7}));
+}
+
+TEST(Set_Functions, InsertHint) {
+  s21::set<int> s;
+  std::set<int> expected;
+  auto hint = s.end();
+  for (int i = 0; i < 500; i++) {
+    int key = i % 10 == 0 ? i - 7 : i;  // почти по возрастанию
+    hint = s.insert(hint, key);
+    EXPECT_EQ(*hint, key);
+    expected.insert(key);
+  }
+  s.emplace_hint(s.end(), 3);
+  ASSERT_EQ(s.size(), expected.size());
+  auto it = expected.begin();
+  for (int key : s) EXPECT_EQ(key, *it++);
+}
+
+TEST(Set_Constructors, CopyAssignReplaces) {
+  const s21::set<int> a{1, 2, 3};
+  s21::set<int> b{7, 8};
+  b = a;
+  EXPECT_EQ(b.size(), 3U);
+  EXPECT_FALSE(b.contains(7));
+  int expected = 1;
+  for (auto it = b.begin(); it != b.end(); ++it) EXPECT_EQ(*it, expected++);
+  const s21::set<int>& same = b;
+  b = same;
+  EXPECT_EQ(b.size(), 3U);
+
+  const s21::map<int, int> m{{1, 1}};
+  s21::map<int, int> m2{{5, 5}, {6, 6}};
+  m2 = m;
+  EXPECT_EQ(m2.size(), 1U);
+  EXPECT_EQ(m2.at(1), 1);
+}
+
+TEST(Set_Iterators, BeginFollowsSmallestKey) {
+  s21::set<int> s;
+  EXPECT_EQ(s.begin(), s.end());
+  int smallest = 100;
+  for (int key : {50, 40, 60, 10, 45, 5}) {
+    s.insert(key);
+    smallest = std::min(smallest, key);
+    EXPECT_EQ(*s.begin(), smallest);
+  }
+  s.insert(s.begin(), 1);  // подсказка перед первым узлом
+  EXPECT_EQ(*s.begin(), 1);
+  for (int expected : {1, 5, 10, 40, 45, 50, 60}) {
+    EXPECT_EQ(*s.begin(), expected);
+    s.erase(s.begin());
+  }
+  EXPECT_EQ(s.begin(), s.end());
+  s21::set<int> other{3, 2};
+  s.swap(other);
+  EXPECT_EQ(*s.begin(), 2);
+  s21::set<int> copy(s);
+  EXPECT_EQ(*copy.begin(), 2);
+}
+
 // int main(int argc, char **argv) {
 //   std::cout << "======================= SET TESTS ======================="
 //             << std::endl;
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "../s21_containers.h"
+
+TEST(Spsc_Queue, PushPop) {
+  s21::spsc_queue<std::string> q(3);
+  EXPECT_EQ(q.capacity(), 4);
+  EXPECT_TRUE(q.empty());
+
+  EXPECT_TRUE(q.try_push("a"));
+  EXPECT_TRUE(q.try_push(std::string("b")));
+  EXPECT_TRUE(q.try_push("c"));
+  EXPECT_TRUE(q.try_push("d"));
+  EXPECT_FALSE(q.try_push("e"));
+  EXPECT_EQ(q.size(), 4);
+
+  std::string out;
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_TRUE(q.try_push("e"));
+  for (const char* expected : {"b", "c", "d", "e"}) {
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, expected);
+  }
+  EXPECT_FALSE(q.try_pop(out));
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(Spsc_Queue, Batches) {
+  s21::spsc_queue<int> q(8);
+  int in[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  int out[10] = {};
+
+  EXPECT_EQ(q.try_push_n(in, 5), 5);
+  EXPECT_EQ(q.try_push_n(in + 5, 5), 3);
+  EXPECT_EQ(q.try_pop_n(out, 4), 4);
+  EXPECT_EQ(q.try_push_n(in + 8, 2), 2);
+  EXPECT_EQ(q.try_pop_n(out + 4, 10), 6);
+  for (int i = 0; i < 10; i++) EXPECT_EQ(out[i], i);
+  EXPECT_EQ(q.try_pop_n(out, 1), 0);
+}
+
+TEST(Spsc_Queue, TwoThreads) {
+  const int count = 200000;
+  s21::spsc_queue<int> q(64);
+
+  std::thread producer([&] {
+    for (int i = 0; i < count; i++) {
+      while (!q.try_push(i)) std::this_thread::yield();
+    }
+  });
+
+  int expected = 0;
+  bool ordered = true;
+  while (expected < count) {
+    int batch[16];
+    size_t got = q.try_pop_n(batch, 16);
+    for (size_t i = 0; i < got; i++) ordered &= batch[i] == expected++;
+    if (got == 0) std::this_thread::yield();
+  }
+  producer.join();
+
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(q.empty());
+}
+
+// считает живые объекты; копия и присваивание бросают на заданном номере
+struct Tracked {
+  static int live;
+  static int countdown;
+  int value;
+  explicit Tracked(int v = 0) : value(v) { live++; }
+  Tracked(const Tracked& other) : value(other.value) {
+    tick();
+    live++;
+  }
+  Tracked& operator=(Tracked&& other) {
+    tick();
+    value = other.value;
+    return *this;
+  }
+  ~Tracked() { live--; }
+  static void tick() {
+    if (countdown > 0 && --countdown == 0) throw std::runtime_error("tick");
+  }
+};
+int Tracked::live = 0;
+int Tracked::countdown = 0;
+
+TEST(Spsc_Queue, BatchThrowKeepsQueueConsistent) {
+  {
+    s21::spsc_queue<Tracked> q(8);
+    Tracked in[4] = {Tracked(0), Tracked(1), Tracked(2), Tracked(3)};
+    Tracked::countdown = 3;  // бросает третья копия
+    EXPECT_THROW(q.try_push_n(in, 4), std::runtime_error);
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(Tracked::live, 4);
+
+    EXPECT_EQ(q.try_push_n(in, 4), 4);
+    Tracked out[4];
+    Tracked::countdown = 3;  // бросает третье присваивание
+    EXPECT_THROW(q.try_pop_n(out, 4), std::runtime_error);
+    EXPECT_EQ(q.size(), 2);
+    EXPECT_EQ(q.try_pop_n(out + 2, 4), 2);
+    for (int i = 0; i < 4; i++) EXPECT_EQ(out[i].value, i);
+    EXPECT_EQ(q.try_push_n(in, 3), 3);
+  }
+  EXPECT_EQ(Tracked::live, 0);
+}
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <stack>
+#include <string>
+
 #include "../s21_containers.h"
 
 TEST(Stack_stackTest, IsemptyOnInit) {
@@ -174,6 +178,125 @@ TEST(Stack_stackInsertManyFrontTest, InsertElementsOfDifferentTypes) {
   EXPECT_EQ(stack.top(), 1);
 }
 
+TEST(Stack_stackTest, pushMoveOnly) {
+  s21::stack<std::unique_ptr<int>> stack;
+  stack.push(std::make_unique<int>(1));
+  stack.push(std::make_unique<int>(2));
+  EXPECT_EQ(*stack.top(), 2);
+  EXPECT_EQ(stack.size(), 2);
+}
+
+TEST(Stack_stackTest, emplace) {
+  s21::stack<std::pair<int, std::string>> stack;
+  stack.emplace(1, "one");
+  stack.emplace(2, "two");
+  EXPECT_EQ(stack.top().second, "two");
+  stack.pop();
+  EXPECT_EQ(stack.top().first, 1);
+}
+
+TEST(Stack, PoolAllocator) {
+  using PooledStack =
+      s21::stack<std::string, s21::list<std::string, s21::pool_allocator>>;
+  PooledStack our_stack;
+  std::stack<std::string> std_stack;
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 300; i++) {
+      our_stack.push(std::to_string(i + round));
+      std_stack.push(std::to_string(i + round));
+    }
+    for (int i = 0; i < 250; i++) {
+      our_stack.pop();
+      std_stack.pop();
+    }
+    EXPECT_EQ(our_stack.size(), std_stack.size());
+    EXPECT_EQ(our_stack.top(), std_stack.top());
+  }
+  PooledStack moved(std::move(our_stack));
+  EXPECT_TRUE(our_stack.empty());
+  EXPECT_EQ(moved.top(), std_stack.top());
+  our_stack.push("x");
+  moved.swap(our_stack);
+  EXPECT_EQ(moved.top(), "x");
+
+  using SharedStack =
+      s21::stack<int, s21::list<int, s21::shared_pool_allocator>>;
+  s21::shared_pool pool;
+  s21::list<int, s21::shared_pool_allocator> items(pool);
+  for (int value : {1, 2, 3}) items.push_back(value);
+  SharedStack shared(items);
+  SharedStack copy(shared);
+  EXPECT_TRUE(copy == shared);
+  copy.pop();
+  EXPECT_EQ(copy.top(), 2);
+}
+
+TEST(Stack, ContiguousStorage) {
+  s21::stack<std::string> our_stack{"a", "b"};
+  for (int i = 0; i < 100; i++) our_stack.push(std::to_string(i));
+  s21::stack<std::string> copy(our_stack);
+  EXPECT_EQ(copy.size(), 102);
+  EXPECT_EQ(copy.top(), "99");
+  copy = s21::stack<std::string>{"x"};
+  EXPECT_EQ(copy.top(), "x");
+  copy = our_stack;
+  while (!our_stack.empty()) {
+    EXPECT_EQ(copy.top(), our_stack.top());
+    copy.pop();
+    our_stack.pop();
+  }
+  EXPECT_TRUE(copy.empty());
+
+  s21::vector<int> base{1, 2, 3};
+  s21::stack<int> from_vector(base);
+  EXPECT_EQ(from_vector.top(), 3);
+  EXPECT_EQ(from_vector.size(), 3);
+  static_assert(std::is_same_v<s21::stack<int>::container_type,
+                               s21::vector<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::stack<int>>);
+}
+
+TEST(Stack, RelationalOperators) {
+  s21::stack<int> a{1, 2, 3};
+  s21::stack<int> b{1, 2, 3};
+  std::stack<int> std_a, std_b;
+  for (int v : {1, 2, 3}) {
+    std_a.push(v);
+    std_b.push(v);
+  }
+  EXPECT_TRUE(a == b);
+  EXPECT_FALSE(a != b);
+  EXPECT_FALSE(a < b);
+  EXPECT_TRUE(a <= b);
+  EXPECT_TRUE(a >= b);
+
+  b.push(0);
+  std_b.push(0);
+  EXPECT_EQ(a == b, std_a == std_b);
+  EXPECT_EQ(a < b, std_a < std_b);
+  EXPECT_EQ(a > b, std_a > std_b);
+
+  b.pop();
+  b.pop();
+  b.push(4);
+  std_b.pop();
+  std_b.pop();
+  std_b.push(4);
+  EXPECT_EQ(a < b, std_a < std_b);
+  EXPECT_EQ(a <= b, std_a <= std_b);
+  EXPECT_EQ(b > a, std_b > std_a);
+  EXPECT_EQ(b >= a, std_b >= std_a);
+  EXPECT_TRUE(a != b);
+
+  s21::stack<std::string, s21::list<std::string>> x{"a", "b"};
+  s21::stack<std::string, s21::list<std::string>> y{"a", "c"};
+  EXPECT_TRUE(x < y);
+  EXPECT_FALSE(x == y);
+  y.pop();
+  y.push("b");
+  EXPECT_TRUE(x == y);
+}
+
 // int main(int argc, char **argv) {
 //   std::cout << "======================= STACK TESTS ======================="
 //             << std::endl;
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_map>
+
+#include "../s21_containers.h"
+
+TEST(Unordered_Map_Constructors, test_1) {
+  s21::unordered_map<int, int> m1;
+  std::unordered_map<int, int> m2;
+
+  EXPECT_EQ(m1.size(), m2.size());
+  EXPECT_TRUE(m1.empty());
+  EXPECT_TRUE(m1.begin() == m1.end());
+}
+
+TEST(Unordered_Map_Constructors, test_2) {
+  s21::unordered_map<int, int> m1 = {{1, 10}, {2, 20}, {3, 30}, {2, 40}};
+  std::unordered_map<int, int> m2 = {{1, 10}, {2, 20}, {3, 30}, {2, 40}};
+
+  EXPECT_EQ(m1.size(), m2.size());
+  for (const auto &el : m2) EXPECT_EQ(m1.at(el.first), el.second);
+}
+
+TEST(Unordered_Map_Constructors, test_3) {
+  s21::unordered_map<std::string, int> m1 = {{"a", 1}, {"b", 2}, {"c", 3}};
+  s21::unordered_map<std::string, int> m2 = m1;
+  s21::unordered_map<std::string, int> m3 = std::move(m1);
+
+  EXPECT_EQ(m1.size(), 0);
+  EXPECT_EQ(m2.size(), 3);
+  EXPECT_EQ(m3.size(), 3);
+  EXPECT_EQ(m2.at("b"), 2);
+  EXPECT_EQ(m3.at("c"), 3);
+
+  m1 = m2;
+  EXPECT_EQ(m1.at("a"), 1);
+}
+
+TEST(Unordered_Map_Access, test_1) {
+  s21::unordered_map<int, std::string> m = {{1, "one"}, {2, "two"}};
+
+  EXPECT_EQ(m.at(1), "one");
+  EXPECT_THROW(m.at(3), std::out_of_range);
+  EXPECT_EQ(m[3], "");
+  EXPECT_EQ(m.size(), 3);
+  m[3] = "three";
+  EXPECT_EQ(m.at(3), "three");
+}
+
+TEST(Unordered_Map_Insert, test_1) {
+  s21::unordered_map<int, int> m;
+
+  auto result = m.insert(1, 1);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ((*result.first).first, 1);
+
+  result = m.insert({1, 2});
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ((*result.first).second, 1);
+
+  result = m.insert_or_assign(1, 3);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(m.at(1), 3);
+}
+
+TEST(Unordered_Map_Insert, InsertMany) {
+  s21::unordered_map<int, int> m;
+  auto results = m.insert_many(std::pair(1, 1), std::pair(2, 2),
+                               std::pair(1, 3), std::pair(4, 4));
+
+  EXPECT_EQ(results.size(), 4);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[2].second);
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_EQ(m.at(1), 1);
+}
+
+// вставки из той же пачки вытесняют уже вставленные ключи; итераторы
+// результата все равно указывают на свои ключи
+TEST(Unordered_Map_Insert, InsertManyIteratorsMatchKeys) {
+  s21::unordered_map<int, std::string> m;
+  unsigned seed = 12345;
+  auto next = [&seed] {
+    seed = seed * 1103515245u + 12345u;
+    return static_cast<int>(seed >> 8) % 5000;
+  };
+  for (int batch = 0; batch < 1000; batch++) {
+    int keys[6];
+    for (int& key : keys) key = next();
+    auto results = m.insert_many(
+        std::pair(keys[0], std::to_string(keys[0])),
+        std::pair(keys[1], std::to_string(keys[1])),
+        std::pair(keys[2], std::to_string(keys[2])),
+        std::pair(keys[3], std::to_string(keys[3])),
+        std::pair(keys[4], std::to_string(keys[4])),
+        std::pair(keys[5], std::to_string(keys[5])));
+    ASSERT_EQ(results.size(), 6);
+    for (int i = 0; i < 6; i++) {
+      EXPECT_EQ((*results[i].first).first, keys[i]);
+      EXPECT_EQ((*results[i].first).second, std::to_string(keys[i]));
+    }
+  }
+  // аргументы разных типов, ключ строится из const char*
+  s21::unordered_map<std::string, int> words;
+  auto results = words.insert_many(std::pair("a", 1), std::pair("bb", 2L),
+                                   std::make_pair(std::string("a"), 3));
+  EXPECT_EQ((*results[1].first).first, "bb");
+  EXPECT_FALSE(results[2].second);
+  EXPECT_EQ(words.at("a"), 1);
+}
+
+TEST(Unordered_Map_Operations, EraseAndRehash) {
+  s21::unordered_map<int, int> m;
+  std::unordered_map<int, int> m2;
+  for (int i = 0; i < 5000; i++) {
+    m.insert(i * 31, i);
+    m2.insert({i * 31, i});
+  }
+  for (int i = 0; i < 5000; i += 2) {
+    EXPECT_EQ(m.erase(i * 31), 1);
+    m2.erase(i * 31);
+  }
+  EXPECT_EQ(m.erase(-1), 0);
+  m.erase(m.find(31));
+  m2.erase(31);
+
+  EXPECT_EQ(m.size(), m2.size());
+  size_t visited = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, ++visited)
+    EXPECT_EQ((*it).second, m2.at((*it).first));
+  EXPECT_EQ(visited, m2.size());
+  for (int i = 0; i < 5000; i++)
+    EXPECT_EQ(m.contains(i * 31), m2.count(i * 31) == 1);
+}
+
+TEST(Unordered_Map_Operations, SwapMergeClear) {
+  s21::unordered_map<int, int> m1 = {{1, 1}, {2, 2}};
+  s21::unordered_map<int, int> m2 = {{2, 20}, {3, 30}};
+
+  m1.merge(m2);
+  EXPECT_EQ(m1.size(), 3);
+  EXPECT_EQ(m1.at(2), 2);
+  EXPECT_EQ(m2.size(), 1);
+  EXPECT_EQ(m2.at(2), 20);
+
+  m1.swap(m2);
+  EXPECT_EQ(m1.size(), 1);
+  EXPECT_EQ(m2.size(), 3);
+
+  m2.clear();
+  EXPECT_TRUE(m2.empty());
+  EXPECT_FALSE(m2.contains(1));
+  m2[5] = 5;
+  EXPECT_EQ(m2.size(), 1);
+}
+
+// все ключи с одним хешем: цепочки длиннее 255, таблица не растет без конца
+struct ConstantHash {
+  size_t operator()(int) const { return 42; }
+};
+
+TEST(Unordered_Map_Operations, ConstantHash) {
+  s21::unordered_map<int, int, ConstantHash> m;
+  for (int i = 0; i < 1000; i++) EXPECT_TRUE(m.insert(i, -i).second);
+  EXPECT_EQ(m.size(), 1000);
+  EXPECT_LE(m.bucket_count(), 4096);
+  for (int i = 0; i < 1000; i += 2) m.erase(m.find(i));
+  EXPECT_EQ(m.size(), 500);
+  for (int i = 0; i < 1000; i++) EXPECT_EQ(m.contains(i), i % 2 == 1);
+  EXPECT_EQ(m.at(999), -999);
+}
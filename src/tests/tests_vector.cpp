@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
 // #include <ostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -143,6 +145,18 @@ TEST(Modifiers, Clear) {
   EXPECT_EQ(v.data(), nullptr);
 }
 
+TEST(Modifiers, ClearThenInsert) {
+  s21::vector<std::string> v{"a", "b", "c"};
+  v.clear();
+  v.push_back("d");
+  EXPECT_EQ(v.capacity(), 3);
+  EXPECT_EQ(v[0], "d");
+  v.clear();
+  v.insert(v.begin(), "e");
+  EXPECT_EQ(v.front(), "e");
+  EXPECT_EQ(v.size(), 1);
+}
+
 TEST(Modifiers, Pop) {
   s21::vector<int> v{1, 2, 3};
 
@@ -255,6 +269,200 @@ TEST(Modifiers, ForEachModify) {
   for (const auto &elem : v) EXPECT_EQ(5, elem);
 }
 
+TEST(Modifiers, PushBackMoveOnly) {
+  s21::vector<std::unique_ptr<int>> v;
+  for (int i = 0; i < 10; i++) v.push_back(std::make_unique<int>(i));
+  EXPECT_EQ(v.size(), 10);
+  for (int i = 0; i < 10; i++) EXPECT_EQ(*v[i], i);
+}
+
+TEST(Modifiers, PushBackMovesValue) {
+  s21::vector<std::string> v;
+  std::string s(100, 'x');
+  v.push_back(std::move(s));
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(v[0], std::string(100, 'x'));
+}
+
+TEST(Modifiers, EmplaceBack) {
+  s21::vector<std::pair<int, std::string>> v;
+  auto &ref = v.emplace_back(1, "one");
+  EXPECT_EQ(ref.first, 1);
+  v.emplace_back(2, "two");
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[1].second, "two");
+}
+
+TEST(Modifiers, EmplaceBackOwnElement) {
+  s21::vector<std::string> v{"first"};
+  for (int i = 0; i < 50; i++) v.emplace_back(v[0]);
+  EXPECT_EQ(v.size(), 51);
+  EXPECT_EQ(v[50], "first");
+}
+
+TEST(Modifiers, EmplaceAtPosition) {
+  s21::vector<std::string> v{"a", "c"};
+  auto it = v.emplace(v.begin() + 1, 1, 'b');
+  EXPECT_EQ(*it, "b");
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[2], "c");
+}
+
+TEST(Constructors, MoveStealsBuffer) {
+  s21::vector<int> v{1, 2, 3};
+  int *data = v.data();
+  s21::vector<int> n(std::move(v));
+  EXPECT_EQ(n.data(), data);
+  EXPECT_EQ(n.size(), 3);
+  EXPECT_EQ(v.size(), 0);
+
+  s21::vector<int> m{7};
+  m = std::move(n);
+  EXPECT_EQ(m.data(), data);
+  EXPECT_EQ(m.size(), 3);
+  static_assert(std::is_nothrow_move_constructible_v<s21::vector<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::vector<int>>);
+}
+
+TEST(Constructors, CopyAssignNonEmpty) {
+  s21::vector<std::string> v{"a", "b"};
+  s21::vector<std::string> n{"c", "d", "e"};
+  v = n;
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[2], "e");
+}
+
+namespace {
+struct Alive {
+  static int count;
+  Alive() { count++; }
+  Alive(const Alive &) { count++; }
+  ~Alive() { count--; }
+};
+int Alive::count = 0;
+}  // namespace
+
+TEST(Capacity, ReserveConstructsNothing) {
+  {
+    s21::vector<Alive> v(100);
+    EXPECT_EQ(Alive::count, 0);
+    v.reserve(1000);
+    EXPECT_EQ(Alive::count, 0);
+    for (int i = 0; i < 300; i++) v.push_back(Alive());
+    EXPECT_EQ(Alive::count, 300);
+    v.pop_back();
+    v.erase(v.begin());
+    EXPECT_EQ(Alive::count, 298);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 298);
+    EXPECT_EQ(Alive::count, 298);
+    v.clear();
+    EXPECT_EQ(Alive::count, 0);
+  }
+  EXPECT_EQ(Alive::count, 0);
+}
+
+TEST(Capacity, GrowStrings) {
+  s21::vector<std::string> v;
+  for (int i = 0; i < 1000; i++) v.push_back(std::string(40, 'a' + i % 26));
+  EXPECT_EQ(v.size(), 1000);
+  EXPECT_EQ(v[999], std::string(40, 'a' + 999 % 26));
+  v.insert(v.begin() + 500, "middle");
+  EXPECT_EQ(v[500], "middle");
+  EXPECT_EQ(v[501], std::string(40, 'a' + 500 % 26));
+}
+
+TEST(Modifiers, InsertKeepsCapacity) {
+  s21::vector<int> v;
+  v.reserve(100);
+  for (int i = 0; i < 50; i++) v.insert(v.begin(), i);
+  EXPECT_EQ(v.capacity(), 100);
+  EXPECT_EQ(v.size(), 50);
+  for (int i = 0; i < 50; i++) EXPECT_EQ(v[i], 49 - i);
+  v.erase(v.begin() + 10);
+  EXPECT_EQ(v.capacity(), 100);
+  EXPECT_EQ(v[10], 38);
+}
+
+TEST(Modifiers, InsertOwnElementMiddle) {
+  s21::vector<std::string> v{"a", "b", "c"};
+  v.reserve(10);
+  v.insert(v.begin() + 1, v[2]);
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[1], "c");
+  EXPECT_EQ(v[2], "b");
+  EXPECT_EQ(v[3], "c");
+}
+
+TEST(Modifiers, InsertRange) {
+  std::string src[] = {"x", "y", "z"};
+  s21::vector<std::string> v{"a", "b"};
+  auto it = v.insert(v.begin() + 1, src, src + 3);
+  EXPECT_EQ(*it, "x");
+  EXPECT_EQ(v.size(), 5);
+  const char *expected[] = {"a", "x", "y", "z", "b"};
+  for (int i = 0; i < 5; i++) EXPECT_EQ(v[i], expected[i]);
+
+  v.reserve(20);
+  v.insert(v.end(), src, src + 3);
+  v.insert(v.begin(), src, src);
+  EXPECT_EQ(v.size(), 8);
+  EXPECT_EQ(v[7], "z");
+  EXPECT_EQ(v.capacity(), 20);
+}
+
+TEST(Modifiers, InsertRangeFromList) {
+  s21::list<int> l{4, 5, 6};
+  s21::vector<int> v{1, 2, 3, 7};
+  v.insert(v.begin() + 3, l.begin(), l.end());
+  EXPECT_EQ(v.size(), 7);
+  for (int i = 0; i < 7; i++) EXPECT_EQ(v[i], i + 1);
+}
+
+TEST(Modifiers, EraseRange) {
+  s21::vector<std::string> v{"0", "1", "2", "3", "4", "5"};
+  auto it = v.erase(v.begin() + 1, v.begin() + 4);
+  EXPECT_EQ(*it, "4");
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], "0");
+  EXPECT_EQ(v[2], "5");
+  it = v.erase(v.begin() + 1, v.end());
+  EXPECT_TRUE(it == v.end());
+  EXPECT_EQ(v.size(), 1);
+  v.erase(v.begin(), v.begin());
+  EXPECT_EQ(v.size(), 1);
+}
+
+TEST(Modifiers, InsertManySingleAllocation) {
+  s21::vector<std::string> v{"a", "e"};
+  v.reserve(10);
+  std::string *data = v.data();
+  auto it = v.insert_many(v.begin() + 1, "b", std::string("c"), "d");
+  EXPECT_EQ(*it, "b");
+  EXPECT_EQ(v.data(), data);
+  const char *expected[] = {"a", "b", "c", "d", "e"};
+  for (int i = 0; i < 5; i++) EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(Modifiers, InsertManyOwnElements) {
+  s21::vector<std::string> v{"x", "y"};
+  v.insert_many(v.begin(), v[1], v[0]);
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[0], "y");
+  EXPECT_EQ(v[1], "x");
+  EXPECT_EQ(v[2], "x");
+  EXPECT_EQ(v[3], "y");
+}
+
+TEST(Modifiers, InsertManyRange) {
+  std::vector<int> src{3, 4, 5};
+  s21::vector<int> v{1, 2, 6};
+  v.insert_many(v.begin() + 2, src.begin(), src.end());
+  EXPECT_EQ(v.size(), 6);
+  for (int i = 0; i < 6; i++) EXPECT_EQ(v[i], i + 1);
+}
+
 // int main(int argc, char **argv) {
 //   std::cout << "======================= VECTOR TESTS ======================="
 //             << std::endl;